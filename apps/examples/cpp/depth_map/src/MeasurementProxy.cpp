@@ -16,7 +16,7 @@ namespace eduart {
 
 MeasurementProxy::MeasurementProxy() {
   // Register the proxy with the Logger to get the log output
-  logger::Logger::getInstance()->registerClient(this);
+  logger::Logger::getInstance()->registerClient(this, logger::LogVerbosity::Info);
 }
 
 MeasurementProxy::~MeasurementProxy() {
@@ -35,10 +35,8 @@ void MeasurementProxy::onRawTofMeasurement([[maybe_unused]] const std::vector<me
 }
 
 void MeasurementProxy::onOutputLog([[maybe_unused]] logger::LogVerbosity verbosity, [[maybe_unused]] const std::string& msg) {
-  if (verbosity > logger::LogVerbosity::Debug) {
-    std::cout << "[" << verbosity << "] " << msg << std::endl;
-    _reset_cursor = false;
-  }
+  std::cout << "[" << verbosity << "] " << msg << std::endl;
+  _reset_cursor = false;
 }
 
 std::string MeasurementProxy::depthToColor(double depth, double min, double max) {
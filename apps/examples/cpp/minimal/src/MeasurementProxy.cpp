@@ -16,7 +16,7 @@ namespace eduart {
 
 MeasurementProxy::MeasurementProxy() {
   // Register the proxy with the Logger to get the log output
-  logger::Logger::getInstance()->registerClient(this);
+  logger::Logger::getInstance()->registerClient(this, logger::LogVerbosity::Info);
 }
 
 MeasurementProxy::~MeasurementProxy() {
@@ -31,6 +31,14 @@ double MeasurementProxy::getRate() {
   return rate;
 }
 
+double MeasurementProxy::getCpuTimePerFrame() {
+  auto cpu_time  = std::clock();
+  auto frames    = _cpu_counter.exchange(0);
+  auto cpu_ms    = 1000.0 * static_cast<double>(cpu_time - _last_cpu_time) / CLOCKS_PER_SEC;
+  _last_cpu_time = cpu_time;
+  return (frames > 0) ? cpu_ms / frames : 0.0;
+}
+
 bool MeasurementProxy::gotFirstMeasurement() {
   return _init_flag;
 }
@@ -40,12 +48,11 @@ void MeasurementProxy::onRawTofMeasurement([[maybe_unused]] const std::vector<me
   _last_measurement = Clock::now();
   _init_flag        = true;
   _counter++;
+  _cpu_counter++;
 }
 
 void MeasurementProxy::onOutputLog([[maybe_unused]] logger::LogVerbosity verbosity, [[maybe_unused]] const std::string& msg) {
-  if (verbosity > logger::LogVerbosity::Debug) {
-    std::cout << "[" << verbosity << "] " << msg << std::endl;
-  }
+  std::cout << "[" << verbosity << "] " << msg << std::endl;
 }
 
 } // namespace eduart
\ No newline at end of file
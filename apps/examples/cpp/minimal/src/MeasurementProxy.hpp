@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <ctime>
 #include <sensorring/MeasurementClient.hpp>
 #include <sensorring/logger/LoggerClient.hpp>
 
@@ -34,6 +35,13 @@ class MeasurementProxy : public manager::MeasurementClient, public logger::Logge
    */
   double getRate();
 
+  /**
+   * @brief Get the process CPU time spent per measurement since the last call of this method. Includes the time of
+   * all threads of the sensorring library. Note that std::clock measures the wall time on Windows.
+   * @return CPU time per measurement in ms
+   */
+  double getCpuTimePerFrame();
+
   /**
    * @brief Check if the client got the first measurement
    * @return true if the client already got the first measurement
@@ -60,6 +68,9 @@ class MeasurementProxy : public manager::MeasurementClient, public logger::Logge
   TimePoint _last_measurement        = Clock::now();
   std::atomic<bool> _init_flag       = false;
   std::atomic<unsigned int> _counter = 0;
+
+  std::clock_t _last_cpu_time            = std::clock();
+  std::atomic<unsigned int> _cpu_counter = 0;
 };
 
 } // namespace eduart
\ No newline at end of file
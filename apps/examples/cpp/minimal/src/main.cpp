@@ -3,7 +3,7 @@
 /**
  * @file   main.cpp
  * @author EduArt Robotik GmbH
- * @brief  This example receives measurements and prints the current measurement rate to the command line.
+ * @brief  This example receives measurements and prints the current measurement rate and the CPU time per measurement to the command line.
  * @date 2025-11-18
  */
 
@@ -67,7 +67,7 @@ int main(int, char*[]) {
     if (manager->isMeasuring()) {
       std::cout << std::endl << "Printing measurement rate:" << std::endl;
       while (manager->isMeasuring()) {
-        std::cout << "Current rate: " << std::fixed << std::setprecision(2) << std::setw(5) << proxy->getRate() << " Hz\r" << std::flush;
+        std::cout << "Current rate: " << std::fixed << std::setprecision(2) << std::setw(5) << proxy->getRate() << " Hz, CPU time: " << std::setw(6) << proxy->getCpuTimePerFrame() << " ms/frame\r" << std::flush;
         std::this_thread::sleep_for(1s);
       }
 
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  This example records the frames of a simulated interface to a log file and replays the log as fast as possible. The replay measures the throughput of the decoding and the client notification. Pass the path of an existing log file to replay a recording of real hardware with the same topology instead.
+ * @date 2026-10-17
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sensorring/MeasurementClient.hpp>
+#include <sensorring/MeasurementManager.hpp>
+#include <string>
+#include <thread>
+
+using namespace eduart;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t BOARD_COUNT   = 16;
+static constexpr auto RECORDING_DURATION   = 10s;
+static constexpr auto REPLAY_IDLE_DURATION = 1s;
+static const std::string LOG_FILE          = "sensorring_frames.bin";
+
+/**
+ * @class Client that receives the measurements to include the client notification in the benchmark
+ */
+class CountingClient : public manager::MeasurementClient {
+public:
+  void onTransformedTofMeasurement(const std::vector<measurement::TofMeasurement>& measurement_vec) override { _sensor_frames += measurement_vec.size(); }
+
+private:
+  std::atomic<std::size_t> _sensor_frames = 0;
+};
+
+manager::ManagerParams makeParams(bus::BusParams bus) {
+  manager::ManagerParams params;
+
+  sensor::TofSensorParams tof;
+  tof.enable = true;
+
+  sensor::ThermalSensorParams thermal;
+  thermal.enable = true;
+
+  for (std::size_t board_idx = 0; board_idx < BOARD_COUNT; board_idx++) {
+    sensor::SensorBoardParams board;
+    tof.user_idx         = static_cast<int>(board_idx);
+    thermal.user_idx     = static_cast<int>(board_idx);
+    board.tof_params     = tof;
+    board.thermal_params = thermal;
+    bus.board_param_vec.push_back(board);
+  }
+
+  params.ring_params.bus_param_vec.push_back(bus);
+  return params;
+}
+
+void record() {
+  bus::BusParams bus;
+  bus.interface_name = "sim0";
+  bus.type           = com::InterfaceType::SIMULATED;
+  bus.record_file    = LOG_FILE;
+
+  auto manager = std::make_unique<manager::MeasurementManager>(makeParams(bus));
+  manager->startMeasuring();
+  std::this_thread::sleep_for(RECORDING_DURATION);
+  manager->stopMeasuring();
+
+  std::cout << "Recorded " << manager->getStatistics().tof_frames_published << " ToF frames to " << LOG_FILE << std::endl;
+}
+
+void replay(const std::string& log_file) {
+  bus::BusParams bus;
+  bus.interface_name   = "replay0";
+  bus.type             = com::InterfaceType::REPLAY;
+  bus.replay.log_file  = log_file;
+  bus.replay.real_time = false;
+
+  CountingClient client;
+  auto manager = std::make_unique<manager::MeasurementManager>(makeParams(bus));
+  manager->registerClient(&client);
+  manager->startMeasuring();
+
+  // the replay is finished when no new frames are published anymore
+  std::uint64_t frames = 0;
+  auto first_frame     = std::chrono::steady_clock::now();
+  auto last_frame      = first_frame;
+  while (manager->isMeasuring() && (frames == 0 || std::chrono::steady_clock::now() - last_frame < REPLAY_IDLE_DURATION)) {
+    const auto published = manager->getStatistics().tof_frames_published;
+    if (published != frames) {
+      if (frames == 0) {
+        first_frame = std::chrono::steady_clock::now();
+      }
+      frames     = published;
+      last_frame = std::chrono::steady_clock::now();
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+  manager->stopMeasuring();
+
+  const auto statistics = manager->getStatistics();
+  const double seconds  = std::chrono::duration<double>(last_frame - first_frame).count();
+
+  double decode_us      = 0.0;
+  std::uint64_t decoded = 0;
+  for (const auto& sensor : statistics.sensors) {
+    decode_us += sensor.tof_decode.meanUs() * sensor.tof_decode.count;
+    decoded += sensor.tof_decode.count;
+  }
+
+  std::cout << "Replayed " << statistics.tof_frames_published << " ToF frames and " << statistics.thermal_frames_published << " thermal frames in " << std::fixed << std::setprecision(3) << seconds << " s";
+  if (seconds > 0.0) {
+    std::cout << " (" << std::setprecision(1) << statistics.tof_frames_published / seconds << " ToF frames/s)";
+  }
+  std::cout << std::endl;
+
+  if (decoded > 0) {
+    std::cout << "Mean ToF decode time: " << std::setprecision(2) << decode_us / decoded << " µs per sensor" << std::endl;
+  }
+
+  for (const auto& client_statistics : statistics.clients) {
+    std::cout << "Mean notify time of the client: " << std::setprecision(3) << client_statistics.notify.meanUs() << " µs in " << client_statistics.notify.count << " callbacks" << std::endl;
+  }
+
+  manager->unregisterClient(&client);
+}
+
+int main(int argc, char* argv[]) {
+  std::cout << "=========================" << std::endl;
+  std::cout << "Sensorring replay example" << std::endl;
+  std::cout << "=========================" << std::endl;
+  std::cout << std::endl;
+
+  try {
+    if (argc > 1) {
+      replay(argv[1]);
+    } else {
+      record();
+      replay(LOG_FILE);
+    }
+  } catch (const std::exception& e) {
+    std::cout << "Caught: " << e.what() << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  This example runs the sensorring on simulated interfaces with 16 sensor boards each and prints the statistics of the measurement pipeline. No hardware is required.
+ * @date 2026-10-17
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sensorring/MeasurementManager.hpp>
+#include <string>
+#include <thread>
+
+using namespace eduart;
+using namespace std::chrono_literals;
+
+static constexpr std::size_t BUS_COUNT       = 2;
+static constexpr std::size_t BOARDS_PER_BUS  = 16;
+static constexpr auto MEASUREMENT_DURATION   = 10s;
+static constexpr double FAULT_PROBABILITY    = 0.0;
+
+void printHistogram(const std::string& name, const manager::LatencyHistogram& histogram) {
+  std::cout << std::left << std::setw(44) << name << std::right << std::fixed << std::setprecision(2);
+  std::cout << " n: " << std::setw(7) << histogram.count;
+  std::cout << "  mean: " << std::setw(9) << histogram.meanUs() / 1000.0 << " ms";
+  std::cout << "  p50: " << std::setw(9) << histogram.percentileUs(50.0) / 1000.0 << " ms";
+  std::cout << "  p99: " << std::setw(9) << histogram.percentileUs(99.0) / 1000.0 << " ms";
+  std::cout << "  max: " << std::setw(9) << histogram.maxUs() / 1000.0 << " ms" << std::endl;
+}
+
+int main(int, char*[]) {
+  std::cout << "=============================" << std::endl;
+  std::cout << "Simulated sensorring example" << std::endl;
+  std::cout << "=============================" << std::endl;
+  std::cout << std::endl;
+
+  // Create the parameter structure with simulated interfaces instead of CAN hardware
+  manager::ManagerParams params;
+  {
+    params.parallel_buses = true;
+
+    sensor::TofSensorParams tof;
+    tof.enable = true;
+
+    sensor::ThermalSensorParams thermal;
+    thermal.enable = true;
+
+    ring::RingParams ring;
+    for (std::size_t bus_idx = 0; bus_idx < BUS_COUNT; bus_idx++) {
+      bus::BusParams bus;
+      bus.interface_name                   = "sim" + std::to_string(bus_idx);
+      bus.type                             = com::InterfaceType::SIMULATED;
+      bus.simulation.jitter_us             = 2000;
+      bus.simulation.drop_probability      = FAULT_PROBABILITY;
+      bus.simulation.duplicate_probability = FAULT_PROBABILITY;
+      bus.simulation.seed                  = static_cast<unsigned int>(bus_idx);
+
+      for (std::size_t board_idx = 0; board_idx < BOARDS_PER_BUS; board_idx++) {
+        sensor::SensorBoardParams board;
+        tof.user_idx         = static_cast<int>(bus_idx * BOARDS_PER_BUS + board_idx);
+        thermal.user_idx     = tof.user_idx;
+        board.tof_params     = tof;
+        board.thermal_params = thermal;
+        bus.board_param_vec.push_back(board);
+      }
+
+      ring.bus_param_vec.push_back(bus);
+    }
+
+    params.ring_params = ring;
+  }
+
+  try {
+    auto manager = std::make_unique<manager::MeasurementManager>(params);
+    manager->startMeasuring();
+
+    std::cout << "Measuring for " << std::chrono::duration_cast<std::chrono::seconds>(MEASUREMENT_DURATION).count() << " s ..." << std::endl;
+    std::this_thread::sleep_for(MEASUREMENT_DURATION);
+    manager->stopMeasuring();
+
+    const auto statistics = manager->getStatistics();
+    const double seconds  = std::chrono::duration<double>(MEASUREMENT_DURATION).count();
+
+    std::cout << std::endl;
+    std::cout << "Published ToF frames:     " << statistics.tof_frames_published << " (" << std::fixed << std::setprecision(2) << statistics.tof_frames_published / seconds << " Hz)" << std::endl;
+    std::cout << "Published thermal frames: " << statistics.thermal_frames_published << " (" << statistics.thermal_frames_published / seconds << " Hz)" << std::endl;
+    std::cout << "Dropped sensor frames:    " << statistics.frames_dropped << std::endl;
+    std::cout << "Timeouts:                 " << statistics.timeouts << std::endl;
+    std::cout << std::endl;
+
+    printHistogram("ToF request to ready", statistics.tof_request_to_ready);
+    printHistogram("ToF fetch to complete", statistics.tof_fetch_to_complete);
+    printHistogram("Thermal fetch to complete", statistics.thermal_fetch_to_complete);
+    for (const auto& state : statistics.states) {
+      if (state.duration.count > 0) {
+        printHistogram("State " + state.name + (state.interface_name.empty() ? "" : " (" + state.interface_name + ")"), state.duration);
+      }
+    }
+
+  } catch (const std::exception& e) {
+    std::cout << "Caught: " << e.what() << std::endl;
+  }
+
+  return 0;
+}
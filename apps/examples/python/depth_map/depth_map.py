@@ -42,9 +42,8 @@ class MeasurementProxy(sensorring.SensorringClient):
 
   # Base class callback
   def onOutputLog(self, verbosity, msg):
-    if verbosity > sensorring.LogVerbosity_Debug:
-      print("[" + sensorring.LogVerbosityToString(verbosity) + "] " + msg)
-      self._reset_cursor = False
+    print("[" + sensorring.LogVerbosityToString(verbosity) + "] " + msg)
+    self._reset_cursor = False
 
 
   def gotFirstMeasurement(self):
@@ -111,7 +110,7 @@ def main():
   proxy = MeasurementProxy()
 
   # Register the proxy with the Logger to get the log output
-  sensorring.Logger.getInstance().registerClient(proxy)
+  sensorring.Logger.getInstance().registerClient(proxy, sensorring.LogVerbosity_Info)
 
   try:
     # Instantiate a MeasurementManager with the parameters from above
@@ -0,0 +1,222 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Stress test of the lock-free ring and the blocking log queue with several producer and consumer threads.
+ * @date 2026-10-17
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logger/LogQueue.hpp"
+#include "utils/BoundedRing.hpp"
+
+using namespace eduart;
+
+static constexpr std::size_t PRODUCERS          = 4;
+static constexpr std::size_t CONSUMERS          = 2;
+static constexpr std::uint64_t VALUES_PER_THREAD = 50000;
+static constexpr std::size_t CAPACITY           = 8;
+
+static std::size_t failures = 0;
+
+void fail(const std::string& check, const std::string& detail) {
+  if (failures < 20) {
+    std::cout << "FAILED " << check << ": " << detail << std::endl;
+  }
+  failures++;
+}
+
+// Every value carries its producer in the upper and its sequence number in the lower half
+std::uint64_t makeValue(std::size_t producer, std::uint64_t seq) {
+  return (static_cast<std::uint64_t>(producer) << 32) | seq;
+}
+
+/**
+ * Check that every pushed value is popped exactly once and that every consumer sees the values of a producer in the
+ * order they were pushed
+ * @param[in] check name of the check
+ * @param[in] popped values popped by each consumer
+ */
+void checkValues(const std::string& check, const std::vector<std::vector<std::uint64_t> >& popped) {
+  std::vector<std::vector<std::uint8_t> > seen(PRODUCERS, std::vector<std::uint8_t>(VALUES_PER_THREAD, 0));
+  for (const auto& values : popped) {
+    std::vector<std::int64_t> last(PRODUCERS, -1);
+    for (const auto value : values) {
+      const auto producer = static_cast<std::size_t>(value >> 32);
+      const auto seq      = static_cast<std::int64_t>(value & 0xFFFFFFFF);
+      if (producer >= PRODUCERS || seq >= static_cast<std::int64_t>(VALUES_PER_THREAD)) {
+        fail(check, "invalid value " + std::to_string(value));
+        continue;
+      }
+      if (seq <= last[producer]) {
+        fail(check, "producer " + std::to_string(producer) + " value " + std::to_string(seq) + " popped after " + std::to_string(last[producer]));
+      }
+      last[producer] = seq;
+      seen[producer][static_cast<std::size_t>(seq)]++;
+    }
+  }
+
+  for (std::size_t producer = 0; producer < PRODUCERS; producer++) {
+    for (std::uint64_t seq = 0; seq < VALUES_PER_THREAD; seq++) {
+      if (seen[producer][seq] != 1) {
+        fail(check, "producer " + std::to_string(producer) + " value " + std::to_string(seq) + " popped " + std::to_string(seen[producer][seq]) + " times");
+      }
+    }
+  }
+}
+
+void checkRing() {
+  utils::BoundedRing<std::uint64_t> ring(CAPACITY);
+  std::atomic<std::size_t> finished_producers(0);
+  std::vector<std::vector<std::uint64_t> > popped(CONSUMERS);
+
+  std::vector<std::thread> threads;
+  for (std::size_t producer = 0; producer < PRODUCERS; producer++) {
+    threads.emplace_back([&ring, &finished_producers, producer] {
+      for (std::uint64_t seq = 0; seq < VALUES_PER_THREAD; seq++) {
+        auto value = makeValue(producer, seq);
+        while (!ring.push(std::move(value))) {
+          std::this_thread::yield();
+        }
+      }
+      finished_producers++;
+    });
+  }
+  for (std::size_t consumer = 0; consumer < CONSUMERS; consumer++) {
+    threads.emplace_back([&ring, &finished_producers, &values = popped[consumer]] {
+      std::uint64_t value;
+      while (true) {
+        // the producers are checked before the pop, so the last values are not missed
+        const bool done = finished_producers.load() == PRODUCERS;
+        if (ring.pop(value)) {
+          values.push_back(value);
+        } else if (done) {
+          break;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  checkValues("BoundedRing", popped);
+}
+
+void checkBlockingQueue() {
+  logger::LogQueue queue(CAPACITY, logger::LogOverflowPolicy::Block);
+  std::vector<std::vector<std::uint64_t> > popped(1);
+  std::atomic<std::size_t> dropped(0);
+
+  std::thread worker([&queue, &values = popped[0]] {
+    queue.setWorker();
+    logger::LogMessage message;
+    while (true) {
+      const bool shut_down = queue.isShutDown();
+      while (queue.pop(message)) {
+        values.push_back(std::stoull(message.msg));
+      }
+      if (shut_down) {
+        break;
+      }
+      queue.wait(std::chrono::milliseconds(10));
+    }
+  });
+
+  std::vector<std::thread> producers;
+  for (std::size_t producer = 0; producer < PRODUCERS; producer++) {
+    producers.emplace_back([&queue, &dropped, producer] {
+      for (std::uint64_t seq = 0; seq < VALUES_PER_THREAD; seq++) {
+        dropped += queue.push(logger::LogMessage{ logger::LogVerbosity::Debug, std::to_string(makeValue(producer, seq)) });
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  queue.shutDown();
+  worker.join();
+
+  if (dropped > 0) {
+    fail("LogQueue", std::to_string(dropped.load()) + " messages dropped with the blocking policy");
+  }
+  checkValues("LogQueue", popped);
+}
+
+void checkShutDown() {
+  logger::LogQueue queue(CAPACITY, logger::LogOverflowPolicy::Block);
+  std::atomic<bool> stop(false);
+  std::atomic<std::uint64_t> pushed(0);
+  std::atomic<std::uint64_t> dropped(0);
+  std::uint64_t received = 0;
+
+  std::thread worker([&queue, &received] {
+    queue.setWorker();
+    logger::LogMessage message;
+    while (!queue.isShutDown()) {
+      while (queue.pop(message)) {
+        received++;
+      }
+      queue.wait(std::chrono::milliseconds(10));
+    }
+  });
+
+  // the producers keep pushing while the queue is shut down, every message is either received or dropped
+  std::vector<std::thread> producers;
+  for (std::size_t producer = 0; producer < PRODUCERS; producer++) {
+    producers.emplace_back([&queue, &stop, &pushed, &dropped] {
+      while (!stop.load()) {
+        dropped += queue.push(logger::LogMessage{ logger::LogVerbosity::Debug, "shut down" });
+        pushed++;
+      }
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  // same order as Logger::stopAsync
+  queue.shutDown();
+  worker.join();
+  queue.waitForProducers();
+  logger::LogMessage message;
+  while (queue.pop(message)) {
+    received++;
+  }
+
+  stop = true;
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  if (queue.pop(message)) {
+    fail("LogQueue shut down", "message queued after the final drain");
+  }
+  if (received + dropped != pushed) {
+    fail("LogQueue shut down", std::to_string(pushed.load()) + " messages pushed, " + std::to_string(received) + " received and " + std::to_string(dropped.load()) + " dropped");
+  }
+}
+
+int main(int, char*[]) {
+  std::cout << "Running " << PRODUCERS << " producers with " << VALUES_PER_THREAD << " values each against a ring of " << CAPACITY << " slots" << std::endl;
+
+  const auto start = std::chrono::steady_clock::now();
+  checkRing();
+  checkBlockingQueue();
+  checkShutDown();
+  const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (failures > 0) {
+    std::cout << failures << " failures" << std::endl;
+    return 1;
+  }
+  std::cout << "Every value was popped exactly once and in order (" << duration << " s)" << std::endl;
+  return 0;
+}
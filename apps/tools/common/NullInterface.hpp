@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "interface/ComInterface.hpp"
+
+namespace eduart {
+
+namespace tools {
+
+/**
+ * @class NullInterface
+ * @brief Communication interface without a bus for the benchmarks and checks. Sent frames are discarded and received
+ * frames are injected by the caller, which runs the dispatch to the observers in its own thread.
+ */
+class NullInterface : public com::ComInterface {
+public:
+  static constexpr std::uint32_t CANID_STATUS  = 0x100;
+  static constexpr std::uint32_t CANID_TOF     = 0x200;
+  static constexpr std::uint32_t CANID_THERMAL = 0x300;
+
+  NullInterface() {
+    _id_map.emplace(com::ComEndpoint("tof_status"), CANID_STATUS);
+    _id_map.emplace(com::ComEndpoint("thermal_status"), CANID_STATUS + 1);
+    _endpoints = com::ComEndpoint::createStaticEndpoints();
+  }
+
+  /**
+   * Forward a frame to the observers of its id
+   * @param[in] id CAN id of the frame
+   * @param[in] data payload of the frame
+   * @param[in] rx_timestamp_ns receive time of the frame
+   * @return true if the id is mapped to a known endpoint
+   */
+  bool dispatch(std::uint32_t id, ByteSpan data, std::uint64_t rx_timestamp_ns) { return notifyObservers(id, data, rx_timestamp_ns); }
+
+  bool send(com::ComEndpoint, const std::vector<std::uint8_t>&) override { return true; }
+
+  bool openInterface(std::string) override { return true; }
+
+  bool closeInterface() override { return true; }
+
+  bool repairInterface() override { return true; }
+
+  void addToFSensorToEndpointMap(std::size_t idx) override { addEndpoint("tof" + std::to_string(idx) + "_data", CANID_TOF + static_cast<std::uint32_t>(idx)); }
+
+  void addThermalSensorToEndpointMap(std::size_t idx) override { addEndpoint("thermal" + std::to_string(idx) + "_data", CANID_THERMAL + static_cast<std::uint32_t>(idx)); }
+
+protected:
+  bool listener() override { return true; }
+
+  std::uint32_t mapEndpointToId(const com::ComEndpoint& endpoint) const override { return _id_map.at(endpoint); }
+
+private:
+  void addEndpoint(const std::string& name, std::uint32_t id) {
+    _id_map.emplace(com::ComEndpoint(name), id);
+    _endpoints.emplace(name);
+    updateDispatchTable();
+  }
+
+  std::map<com::ComEndpoint, std::uint32_t> _id_map;
+};
+
+} // namespace tools
+
+} // namespace eduart
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+#include "sensors/hardware/heimann_htpa32.hpp"
+
+#include "NullInterface.hpp"
+
+namespace eduart {
+
+namespace tools {
+
+// Supply voltage and ambient temperature readings of the synthetic frames, the ambient temperature is about 27 °C
+static constexpr std::uint16_t THERMAL_TEST_VDD  = 31500;
+static constexpr std::uint16_t THERMAL_TEST_PTAT = 30000;
+
+// Size of a CAN FD frame of the sensor
+static constexpr std::size_t THERMAL_TEST_MSG_LENGTH = 64;
+
+/**
+ * Raw thermal frame: 256 little endian electrical offsets followed by 1024 big endian pixel values
+ */
+using ThermalRawFrame = std::array<std::uint8_t, 256 * 2 + NUMBER_OF_PIXEL * 2>;
+
+/**
+ * Create an EEPROM with random calibration coefficients in the value ranges of real sensors
+ * @param[in] seed seed of the random values
+ * @return EEPROM content
+ */
+inline sensor::htpa32::HTPA32Eeprom makeThermalEeprom(unsigned int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> th_gradient(-2000, 2000);
+  std::uniform_int_distribution<int> th_offset(-500, 500);
+  std::uniform_int_distribution<int> vddcomp(-1000, 1000);
+
+  sensor::htpa32::HTPA32Eeprom eeprom;
+  std::memset(&eeprom, 0, sizeof(eeprom));
+  eeprom.grad_scale     = 24;
+  eeprom.tablenumber    = TABLENUMBER;
+  eeprom.vddth1         = 30000;
+  eeprom.vddth2         = 32000;
+  eeprom.ptat_gradient  = 0.01F;
+  eeprom.ptat_offset    = 2700.0F;
+  eeprom.ptat_th1       = 28000;
+  eeprom.ptat_th2       = 32000;
+  eeprom.vddsc_gradient = 16;
+  eeprom.vddsc_offset   = 12;
+
+  for (std::size_t i = 0; i < 256; i++) {
+    eeprom.vddcomp_gradient[i] = static_cast<std::int16_t>(vddcomp(rng));
+    eeprom.vddcomp_offset[i]   = static_cast<std::int16_t>(vddcomp(rng));
+  }
+  for (std::size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
+    eeprom.th_gradient[i] = static_cast<std::int16_t>(th_gradient(rng));
+    eeprom.th_offset[i]   = static_cast<std::int16_t>(th_offset(rng));
+  }
+  return eeprom;
+}
+
+/**
+ * Create a raw frame whose compensated pixel values lie within the look-up table
+ * @param[in] eeprom EEPROM of the sensor
+ * @param[in,out] rng random number generator
+ * @return raw frame
+ */
+inline ThermalRawFrame makeThermalFrame(const sensor::htpa32::HTPA32Eeprom& eeprom, std::mt19937& rng) {
+  std::uniform_int_distribution<int> electrical_offset(29500, 30500);
+  std::uniform_int_distribution<int> signal(-200, 1500);
+
+  ThermalRawFrame frame;
+  std::array<int, 256> offsets;
+  for (std::size_t idx = 0; idx < offsets.size(); idx++) {
+    offsets[idx]       = electrical_offset(rng);
+    frame[idx * 2 + 0] = static_cast<std::uint8_t>(offsets[idx] & 0xFF);
+    frame[idx * 2 + 1] = static_cast<std::uint8_t>(offsets[idx] >> 8);
+  }
+
+  std::uint8_t* pixels = frame.data() + 512;
+  for (std::size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
+    const std::size_t idx = (i % 128) + (i >= NUMBER_OF_PIXEL / 2 ? 128 : 0);
+    const int raw         = std::clamp(offsets[idx] + eeprom.th_offset[i] + signal(rng), 0, 0xFFFF);
+    pixels[i * 2 + 0]     = static_cast<std::uint8_t>(raw >> 8);
+    pixels[i * 2 + 1]     = static_cast<std::uint8_t>(raw & 0xFF);
+  }
+  return frame;
+}
+
+/**
+ * Transfer an EEPROM to a thermal sensor in CAN FD frames like the sensor board does
+ * @param[in] interface interface of the sensor
+ * @param[in] idx index of the sensor
+ * @param[in] eeprom EEPROM content
+ */
+inline void sendThermalEeprom(NullInterface& interface, std::size_t idx, const sensor::htpa32::HTPA32Eeprom& eeprom) {
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(&eeprom);
+  for (std::size_t offset = 0; offset < sizeof(eeprom); offset += THERMAL_TEST_MSG_LENGTH) {
+    std::array<std::uint8_t, THERMAL_TEST_MSG_LENGTH> msg{};
+    std::copy_n(bytes + offset, std::min(THERMAL_TEST_MSG_LENGTH, sizeof(eeprom) - offset), msg.begin());
+    interface.dispatch(NullInterface::CANID_THERMAL + static_cast<std::uint32_t>(idx), ByteSpan(msg.data(), msg.size()), 0);
+  }
+}
+
+/**
+ * Transfer a raw frame to a thermal sensor in CAN FD frames like the sensor board does
+ * @param[in] interface interface of the sensor
+ * @param[in] idx index of the sensor
+ * @param[in] frame raw frame
+ * @param[in] vdd supply voltage reading of the frame
+ * @param[in] ptat ambient temperature reading of the frame
+ */
+inline void sendThermalFrame(NullInterface& interface, std::size_t idx, const ThermalRawFrame& frame, std::uint16_t vdd = THERMAL_TEST_VDD, std::uint16_t ptat = THERMAL_TEST_PTAT) {
+  const auto id                            = NullInterface::CANID_THERMAL + static_cast<std::uint32_t>(idx);
+  const std::array<std::uint8_t, 4> status = { static_cast<std::uint8_t>(vdd & 0xFF), static_cast<std::uint8_t>(vdd >> 8), static_cast<std::uint8_t>(ptat & 0xFF), static_cast<std::uint8_t>(ptat >> 8) };
+  interface.dispatch(id, ByteSpan(status.data(), status.size()), 0);
+
+  for (std::size_t offset = 0; offset < frame.size(); offset += THERMAL_TEST_MSG_LENGTH) {
+    interface.dispatch(id, ByteSpan(frame.data() + offset, THERMAL_TEST_MSG_LENGTH), 0);
+  }
+}
+
+} // namespace tools
+
+} // namespace eduart
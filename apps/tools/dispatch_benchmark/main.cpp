@@ -0,0 +1,105 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Microbenchmark of the receive path from a CAN id to the notify callback of the observers. No hardware is required.
+ * @date 2026-10-17
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/NullInterface.hpp"
+
+using namespace eduart;
+
+static constexpr std::size_t SENSOR_COUNT = 16;
+static constexpr std::size_t FRAME_COUNT  = 20000000;
+
+/**
+ * Observer that only touches the payload, like a sensor that copies a frame into its receive buffer
+ */
+class CountingObserver : public com::ComObserver {
+public:
+  void notify(const com::ComEndpoint&, ByteSpan data) override {
+    frames++;
+    bytes += data.size() + data[0];
+  }
+
+  std::uint64_t frames = 0;
+  std::uint64_t bytes  = 0;
+};
+
+int main(int, char*[]) {
+  tools::NullInterface interface;
+
+  // one observer per sensor and one board observer that listens to the status frames, as in a SensorBus
+  std::vector<std::unique_ptr<CountingObserver>> observers;
+  auto board = std::make_unique<CountingObserver>();
+  board->addEndpoint(com::ComEndpoint("tof_status"));
+  board->addEndpoint(com::ComEndpoint("thermal_status"));
+  for (std::size_t idx = 0; idx < SENSOR_COUNT; idx++) {
+    interface.addToFSensorToEndpointMap(idx);
+    interface.addThermalSensorToEndpointMap(idx);
+
+    auto tof = std::make_unique<CountingObserver>();
+    tof->addEndpoint(com::ComEndpoint("tof" + std::to_string(idx) + "_data"));
+    auto thermal = std::make_unique<CountingObserver>();
+    thermal->addEndpoint(com::ComEndpoint("thermal" + std::to_string(idx) + "_data"));
+
+    observers.push_back(std::move(tof));
+    observers.push_back(std::move(thermal));
+  }
+  for (auto& observer : observers) {
+    interface.registerObserver(observer.get());
+  }
+  interface.registerObserver(board.get());
+
+  // ids in the order of a measurement cycle: data frames of all sensors followed by the status frames
+  std::vector<std::uint32_t> ids;
+  for (std::uint32_t idx = 0; idx < SENSOR_COUNT; idx++) {
+    ids.push_back(tools::NullInterface::CANID_TOF + idx);
+    ids.push_back(tools::NullInterface::CANID_THERMAL + idx);
+  }
+  ids.push_back(tools::NullInterface::CANID_STATUS);
+  ids.push_back(tools::NullInterface::CANID_STATUS + 1);
+
+  std::array<std::uint8_t, 64> payload{};
+  payload[0] = 1;
+
+  std::cout << "Dispatching " << FRAME_COUNT << " frames to " << observers.size() + 1 << " observers" << std::endl;
+
+  std::uint64_t unknown = 0;
+  const auto start      = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < FRAME_COUNT; i++) {
+    if (!interface.dispatch(ids[i % ids.size()], ByteSpan(payload.data(), payload.size()), i)) {
+      unknown++;
+    }
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::uint64_t delivered = board->frames;
+  for (const auto& observer : observers) {
+    delivered += observer->frames;
+  }
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "delivered frames : " << delivered << " (" << unknown << " unknown ids)" << std::endl;
+  std::cout << "elapsed time     : " << elapsed.count() * 1000.0 << " ms" << std::endl;
+  std::cout << "throughput       : " << FRAME_COUNT / elapsed.count() / 1e6 << " Mframes/s" << std::endl;
+  std::cout << "time per frame   : " << elapsed.count() * 1e9 / FRAME_COUNT << " ns" << std::endl;
+
+  for (auto& observer : observers) {
+    interface.unregisterObserver(observer.get());
+  }
+  interface.unregisterObserver(board.get());
+
+  return (delivered == FRAME_COUNT && unknown == 0) ? 0 : 1;
+}
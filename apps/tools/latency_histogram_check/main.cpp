@@ -0,0 +1,123 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Checks the bucketing, mean and percentiles of the latency histograms against hand-computed values.
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sensorring/types/Statistics.hpp"
+#include "utils/LatencyRecorder.hpp"
+
+using namespace eduart;
+using namespace std::chrono_literals;
+
+static std::size_t failures = 0;
+
+void expect(const std::string& check, double value, double expected) {
+  if (std::abs(value - expected) > 1e-9 * std::max(1.0, std::abs(expected))) {
+    std::cout << "FAILED " << check << ": " << value << " instead of " << expected << std::endl;
+    failures++;
+  }
+}
+
+void checkBuckets() {
+  utils::LatencyRecorder recorder;
+  recorder.record(0ns);
+  recorder.record(-5ns);
+  recorder.record(1ns);
+  recorder.record(500ns);
+  recorder.record(1000s);
+
+  const auto histogram = recorder.snapshot();
+  expect("count", static_cast<double>(histogram.count), 5);
+  expect("bucket of 0 ns and negative durations", static_cast<double>(histogram.buckets[0]), 2);
+  expect("bucket of 1 ns", static_cast<double>(histogram.buckets[1]), 1);
+  expect("bucket of 500 ns", static_cast<double>(histogram.buckets[9]), 1);
+  expect("bucket of 1000 s", static_cast<double>(histogram.buckets[manager::LatencyHistogram::BUCKETS - 1]), 1);
+  expect("sum", static_cast<double>(histogram.sum_ns), 1000e9 + 501);
+  expect("max", histogram.maxUs(), 1000e6);
+  expect("upper bound of bucket 9", static_cast<double>(manager::LatencyHistogram::bucketUpperBoundNs(9)), 512);
+}
+
+void checkPercentiles() {
+  manager::LatencyHistogram empty;
+  expect("mean of an empty histogram", empty.meanUs(), 0.0);
+  expect("percentile of an empty histogram", empty.percentileUs(50.0), 0.0);
+
+  // 90 durations of 1 µs in the bucket up to 1024 ns and 10 durations of 1 ms in the bucket up to 2^20 ns
+  utils::LatencyRecorder recorder;
+  for (int i = 0; i < 90; i++) {
+    recorder.record(1us);
+  }
+  for (int i = 0; i < 10; i++) {
+    recorder.record(1ms);
+  }
+
+  const auto histogram = recorder.snapshot();
+  expect("mean", histogram.meanUs(), (90 * 1.0 + 10 * 1000.0) / 100.0);
+  expect("p0", histogram.percentileUs(0.0), 1.024);
+  expect("p50", histogram.percentileUs(50.0), 1.024);
+  expect("p90", histogram.percentileUs(90.0), 1.024);
+  expect("p91 limited to the maximum", histogram.percentileUs(91.0), 1000.0);
+  expect("p100", histogram.percentileUs(100.0), 1000.0);
+  expect("percentile above 100", histogram.percentileUs(150.0), 1000.0);
+
+  // durations below 1 µs keep their fraction
+  utils::LatencyRecorder short_recorder;
+  short_recorder.record(300ns);
+  short_recorder.record(400ns);
+  expect("mean below 1 µs", short_recorder.snapshot().meanUs(), 0.35);
+}
+
+void checkConcurrentRecording() {
+  static constexpr int THREADS = 4;
+  static constexpr int VALUES  = 10000;
+
+  utils::LatencyRecorder recorder;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; t++) {
+    threads.emplace_back([&recorder, t] {
+      for (int i = 0; i < VALUES; i++) {
+        recorder.record(std::chrono::nanoseconds(t * VALUES + i));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto histogram     = recorder.snapshot();
+  const double last_value  = THREADS * VALUES - 1;
+  std::uint64_t bucket_sum = 0;
+  for (const auto count : histogram.buckets) {
+    bucket_sum += count;
+  }
+  expect("concurrent count", static_cast<double>(histogram.count), THREADS * VALUES);
+  expect("concurrent bucket sum", static_cast<double>(bucket_sum), THREADS * VALUES);
+  expect("concurrent sum", static_cast<double>(histogram.sum_ns), last_value * (last_value + 1) / 2);
+  expect("concurrent max", static_cast<double>(histogram.max_ns), last_value);
+}
+
+int main(int, char*[]) {
+  checkBuckets();
+  checkPercentiles();
+  checkConcurrentRecording();
+
+  if (failures > 0) {
+    std::cout << failures << " failures" << std::endl;
+    return 1;
+  }
+  std::cout << "All latency histogram checks passed" << std::endl;
+  return 0;
+}
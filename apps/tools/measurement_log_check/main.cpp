@@ -0,0 +1,353 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Checks the round trip, the lookups and the recovery of unclosed or corrupt files of the measurement log.
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "sensorring/MeasurementLog.hpp"
+#include "utils/MeasurementLogFormat.hpp"
+
+using namespace eduart;
+using filemanager::LogFrameType;
+
+// Every fourth frame spans more than one second, so the writer closes a chunk after frames 3, 7 and 11
+static constexpr std::size_t FRAMES          = 12;
+static constexpr std::uint64_t FIRST_TIME_NS = 1700000000000000000ULL;
+static constexpr std::uint64_t PERIOD_NS     = 400000000ULL;
+
+// The Time-of-Flight frame ids wrap around after five frames like the sensor counters do
+static constexpr unsigned int TOF_ID_WRAP      = 5;
+static constexpr unsigned int THERMAL_FIRST_ID = 100;
+
+static std::size_t failures = 0;
+
+void fail(const std::string& check, const std::string& detail) {
+  std::cout << "FAILED " << check << ": " << detail << std::endl;
+  failures++;
+}
+
+template <typename T> void expectEqual(const std::string& check, const T& value, const T& expected) {
+  if (!(value == expected)) {
+    std::stringstream ss;
+    ss << value << " instead of " << expected;
+    fail(check, ss.str());
+  }
+}
+
+void expectFrames(const std::string& check, const std::vector<std::size_t>& frames, const std::vector<std::size_t>& expected) {
+  if (frames != expected) {
+    std::stringstream ss;
+    ss << "frames";
+    for (const auto frame : frames) {
+      ss << " " << frame;
+    }
+    ss << " instead of";
+    for (const auto frame : expected) {
+      ss << " " << frame;
+    }
+    fail(check, ss.str());
+  }
+}
+
+std::uint64_t frameTime(std::size_t frame_idx) {
+  return FIRST_TIME_NS + frame_idx * PERIOD_NS;
+}
+
+// Even frames hold two Time-of-Flight measurements with one and two points, odd frames one thermal measurement
+std::vector<measurement::TofMeasurement> makeTofFrame(std::size_t frame_idx) {
+  std::vector<measurement::TofMeasurement> measurement_vec(2);
+  for (std::size_t sensor = 0; sensor < measurement_vec.size(); sensor++) {
+    auto& measurement                 = measurement_vec[sensor];
+    measurement.frame_id              = static_cast<unsigned int>(frame_idx / 2) % TOF_ID_WRAP;
+    measurement.first_rx_timestamp_ns = frameTime(frame_idx) - 1000 * (sensor + 1);
+    measurement.last_rx_timestamp_ns  = frameTime(frame_idx) - sensor;
+    measurement.point_cloud.data.resize(sensor + 1);
+    for (std::size_t point = 0; point < measurement.point_cloud.data.size(); point++) {
+      auto& point_data        = measurement.point_cloud.data[point];
+      const double value      = static_cast<double>(frame_idx * 100 + sensor * 10 + point);
+      point_data.point        = { value + 0.25, -value, value * 0.5 };
+      point_data.raw_distance = value + 0.125;
+      point_data.sigma        = 0.001 * value;
+      point_data.user_idx     = static_cast<int>(sensor);
+    }
+  }
+  return measurement_vec;
+}
+
+std::vector<measurement::ThermalMeasurement> makeThermalFrame(std::size_t frame_idx) {
+  std::vector<measurement::ThermalMeasurement> measurement_vec(1);
+  auto& measurement                 = measurement_vec[0];
+  measurement.frame_id              = THERMAL_FIRST_ID + static_cast<unsigned int>(frame_idx / 2);
+  measurement.user_idx              = 3;
+  measurement.first_rx_timestamp_ns = frameTime(frame_idx) - 5000;
+  measurement.last_rx_timestamp_ns  = frameTime(frame_idx);
+  measurement.t_ambient_deg_c       = 21.5 + static_cast<double>(frame_idx);
+  measurement.min_deg_c             = 18.25;
+  measurement.max_deg_c             = 36.75;
+  for (std::size_t i = 0; i < measurement.temp_data_deg_c.data.size(); i++) {
+    measurement.temp_data_deg_c.data[i]   = static_cast<measurement::TemperatureScalar>(20.0 + 0.0625 * static_cast<double>((i + frame_idx) % 256));
+    measurement.grayscale_img.data[i]     = static_cast<std::uint8_t>(i + frame_idx);
+    measurement.falsecolor_img.data[i][0] = static_cast<std::uint8_t>(i);
+    measurement.falsecolor_img.data[i][1] = static_cast<std::uint8_t>(frame_idx);
+    measurement.falsecolor_img.data[i][2] = static_cast<std::uint8_t>(255 - i % 256);
+  }
+  return measurement_vec;
+}
+
+bool sameTof(const std::vector<measurement::TofMeasurement>& a, const std::vector<measurement::TofMeasurement>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); i++) {
+    if (a[i].frame_id != b[i].frame_id || a[i].first_rx_timestamp_ns != b[i].first_rx_timestamp_ns || a[i].last_rx_timestamp_ns != b[i].last_rx_timestamp_ns || a[i].point_cloud.data.size() != b[i].point_cloud.data.size()) {
+      return false;
+    }
+    for (std::size_t p = 0; p < a[i].point_cloud.data.size(); p++) {
+      const auto& pa = a[i].point_cloud.data[p];
+      const auto& pb = b[i].point_cloud.data[p];
+      if (pa.point.x() != pb.point.x() || pa.point.y() != pb.point.y() || pa.point.z() != pb.point.z() || pa.raw_distance != pb.raw_distance || pa.sigma != pb.sigma || pa.user_idx != pb.user_idx) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool sameThermal(const std::vector<measurement::ThermalMeasurement>& a, const std::vector<measurement::ThermalMeasurement>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); i++) {
+    if (a[i].frame_id != b[i].frame_id || a[i].user_idx != b[i].user_idx || a[i].first_rx_timestamp_ns != b[i].first_rx_timestamp_ns || a[i].last_rx_timestamp_ns != b[i].last_rx_timestamp_ns || a[i].t_ambient_deg_c != b[i].t_ambient_deg_c
+        || a[i].min_deg_c != b[i].min_deg_c || a[i].max_deg_c != b[i].max_deg_c || a[i].temp_data_deg_c.data != b[i].temp_data_deg_c.data || a[i].grayscale_img.data != b[i].grayscale_img.data
+        || a[i].falsecolor_img.data != b[i].falsecolor_img.data) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Check that the frames of a log match the written frames
+ * @param[in] check name of the check
+ * @param[in] reader reader with the opened log
+ * @param[in] frame_count number of frames the log should hold
+ */
+void checkFrames(const std::string& check, const filemanager::MeasurementLogReader& reader, std::size_t frame_count) {
+  expectEqual(check + " frame count", reader.getFrameCount(), frame_count);
+
+  for (std::size_t idx = 0; idx < std::min(frame_count, reader.getFrameCount()); idx++) {
+    const bool is_tof = (idx % 2 == 0);
+    expectEqual(check + " type of frame " + std::to_string(idx), static_cast<int>(reader.getFrameType(idx)), static_cast<int>(is_tof ? LogFrameType::Tof : LogFrameType::Thermal));
+    expectEqual(check + " time stamp of frame " + std::to_string(idx), reader.getFrameTimestamp(idx), frameTime(idx));
+
+    std::vector<measurement::TofMeasurement> tof_vec;
+    std::vector<measurement::ThermalMeasurement> thermal_vec;
+    if (is_tof) {
+      if (!reader.readTofFrame(idx, tof_vec) || !sameTof(tof_vec, makeTofFrame(idx))) {
+        fail(check, "Time-of-Flight frame " + std::to_string(idx) + " differs from the written frame");
+      }
+      if (reader.readThermalFrame(idx, thermal_vec)) {
+        fail(check, "Time-of-Flight frame " + std::to_string(idx) + " was read as thermal frame");
+      }
+    } else {
+      if (!reader.readThermalFrame(idx, thermal_vec) || !sameThermal(thermal_vec, makeThermalFrame(idx))) {
+        fail(check, "thermal frame " + std::to_string(idx) + " differs from the written frame");
+      }
+      if (reader.readTofFrame(idx, tof_vec)) {
+        fail(check, "thermal frame " + std::to_string(idx) + " was read as Time-of-Flight frame");
+      }
+    }
+  }
+
+  std::vector<measurement::TofMeasurement> tof_vec;
+  if (reader.readTofFrame(frame_count, tof_vec)) {
+    fail(check, "frame behind the end of the log was read");
+  }
+  expectEqual(check + " type behind the end of the log", static_cast<int>(reader.getFrameType(frame_count)), static_cast<int>(LogFrameType::Invalid));
+}
+
+void checkLookups(const std::string& check, const filemanager::MeasurementLogReader& reader) {
+  constexpr auto END = std::numeric_limits<std::uint64_t>::max();
+
+  // the time range includes its beginning and excludes its end
+  expectFrames(check + " first frame", reader.findFrames(frameTime(0), frameTime(1)), { 0 });
+  expectFrames(check + " empty range", reader.findFrames(frameTime(1), frameTime(1)), {});
+  expectFrames(check + " range of one ns", reader.findFrames(frameTime(1), frameTime(1) + 1), { 1 });
+  expectFrames(check + " range between frames", reader.findFrames(frameTime(1) + 1, frameTime(2)), {});
+  expectFrames(check + " inverted range", reader.findFrames(frameTime(3), frameTime(1)), {});
+  expectFrames(check + " range after the log", reader.findFrames(frameTime(FRAMES - 1) + 1, END), {});
+  expectFrames(check + " range before the log", reader.findFrames(0, frameTime(0)), {});
+  expectFrames(check + " whole log", reader.findFrames(0, END), { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 });
+
+  // the Time-of-Flight ids wrapped around once, ids of one type are not found for the other type
+  expectFrames(check + " wrapped id", reader.findFramesById(LogFrameType::Tof, 0), { 0, 10 });
+  expectFrames(check + " last id", reader.findFramesById(LogFrameType::Tof, TOF_ID_WRAP - 1), { 8 });
+  expectFrames(check + " unknown id", reader.findFramesById(LogFrameType::Tof, TOF_ID_WRAP), {});
+  expectFrames(check + " thermal id", reader.findFramesById(LogFrameType::Thermal, THERMAL_FIRST_ID), { 1 });
+  expectFrames(check + " last thermal id", reader.findFramesById(LogFrameType::Thermal, THERMAL_FIRST_ID + FRAMES / 2 - 1), { 11 });
+  expectFrames(check + " thermal id of the other type", reader.findFramesById(LogFrameType::Tof, THERMAL_FIRST_ID), {});
+  expectFrames(check + " invalid type", reader.findFramesById(LogFrameType::Invalid, 0), {});
+}
+
+std::vector<char> readFile(const std::filesystem::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::filesystem::path& path, const std::vector<char>& content) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+int main(int, char*[]) {
+  const auto directory = std::filesystem::temp_directory_path() / "sensorring_measurement_log_check";
+  std::filesystem::create_directories(directory);
+  const auto log_path = directory / "complete.srlog";
+
+  // write the log
+  {
+    filemanager::MeasurementLogWriter writer;
+    if (!writer.open(directory.string(), log_path.filename().string())) {
+      std::cout << "Unable to create " << log_path << std::endl;
+      return 1;
+    }
+    for (std::size_t idx = 0; idx < FRAMES; idx++) {
+      const bool written = (idx % 2 == 0) ? writer.writeTofMeasurement(makeTofFrame(idx)) : writer.writeThermalMeasurement(makeThermalFrame(idx));
+      if (!written) {
+        fail("write", "frame " + std::to_string(idx) + " was not queued");
+      }
+    }
+    writer.close();
+    expectEqual("written frame count", writer.getFrameCount(), FRAMES);
+    if (writer.writeTofMeasurement(makeTofFrame(0))) {
+      fail("write", "frame was queued after the log was closed");
+    }
+  }
+
+  // round trip and lookups with the index of the closed log
+  {
+    filemanager::MeasurementLogReader reader;
+    if (!reader.open(directory.string(), log_path.filename().string())) {
+      fail("closed log", "unable to open the log");
+    } else {
+      checkFrames("closed log", reader, FRAMES);
+      checkLookups("closed log", reader);
+    }
+  }
+
+  const auto content = readFile(log_path);
+  filemanager::measurementlog::FileHeader header;
+  std::memcpy(&header, content.data(), sizeof(header));
+
+  // a log whose index is cut off is read with the index rebuilt from the chunks
+  {
+    auto cut = content;
+    cut.resize(static_cast<std::size_t>(header.index_offset));
+    writeFile(directory / "no_index.srlog", cut);
+
+    filemanager::MeasurementLogReader reader;
+    if (!reader.open(directory.string(), "no_index.srlog")) {
+      fail("log without index", "unable to open the log");
+    } else {
+      checkFrames("log without index", reader, FRAMES);
+      checkLookups("log without index", reader);
+    }
+  }
+
+  // a log that ends partway through the last chunk, as written by a process that did not close it, keeps the complete chunks
+  {
+    auto cut = content;
+    cut.resize(static_cast<std::size_t>(header.index_offset) - 100);
+    auto unclosed         = header;
+    unclosed.index_offset = 0;
+    unclosed.frame_count  = 0;
+    std::memcpy(cut.data(), &unclosed, sizeof(unclosed));
+    writeFile(directory / "unclosed.srlog", cut);
+
+    filemanager::MeasurementLogReader reader;
+    if (!reader.open(directory.string(), "unclosed.srlog")) {
+      fail("unclosed log", "unable to open the log");
+    } else {
+      checkFrames("unclosed log", reader, 8);
+      expectFrames("unclosed log wrapped id", reader.findFramesById(LogFrameType::Tof, 0), { 0 });
+      expectFrames("unclosed log last thermal id", reader.findFramesById(LogFrameType::Thermal, THERMAL_FIRST_ID + 3), { 7 });
+      expectFrames("unclosed log lost thermal id", reader.findFramesById(LogFrameType::Thermal, THERMAL_FIRST_ID + 4), {});
+      expectFrames("unclosed log whole log", reader.findFrames(0, std::numeric_limits<std::uint64_t>::max()), { 0, 1, 2, 3, 4, 5, 6, 7 });
+    }
+  }
+
+  // a log with only the file header is empty, a log with a cut file header is rejected
+  {
+    auto cut = content;
+    cut.resize(sizeof(header));
+    std::memset(cut.data() + offsetof(filemanager::measurementlog::FileHeader, index_offset), 0, 16);
+    writeFile(directory / "empty.srlog", cut);
+
+    filemanager::MeasurementLogReader reader;
+    if (!reader.open(directory.string(), "empty.srlog")) {
+      fail("empty log", "unable to open the log");
+    } else {
+      expectEqual("empty log frame count", reader.getFrameCount(), std::size_t(0));
+      expectFrames("empty log lookup", reader.findFramesById(LogFrameType::Tof, 0), {});
+    }
+
+    cut.resize(sizeof(header) - 1);
+    writeFile(directory / "cut_header.srlog", cut);
+    if (reader.open(directory.string(), "cut_header.srlog")) {
+      fail("cut file header", "the log was opened");
+    }
+  }
+
+  // corrupt counts are rejected before the measurements are allocated
+  {
+    const std::size_t frame_offset = sizeof(filemanager::measurementlog::FileHeader) + sizeof(filemanager::measurementlog::ChunkHeader);
+    const std::uint32_t corrupt    = std::numeric_limits<std::uint32_t>::max();
+
+    auto corrupt_measurements = content;
+    std::memcpy(corrupt_measurements.data() + frame_offset + offsetof(filemanager::measurementlog::FrameHeader, measurement_count), &corrupt, sizeof(corrupt));
+    writeFile(directory / "corrupt_measurements.srlog", corrupt_measurements);
+
+    auto corrupt_points      = content;
+    const std::size_t record = frame_offset + sizeof(filemanager::measurementlog::FrameHeader);
+    std::memcpy(corrupt_points.data() + record + offsetof(filemanager::measurementlog::TofRecord, point_count), &corrupt, sizeof(corrupt));
+    writeFile(directory / "corrupt_points.srlog", corrupt_points);
+
+    for (const std::string filename : { "corrupt_measurements.srlog", "corrupt_points.srlog" }) {
+      filemanager::MeasurementLogReader reader;
+      std::vector<measurement::TofMeasurement> tof_vec;
+      if (!reader.open(directory.string(), filename)) {
+        fail(filename, "unable to open the log");
+      } else if (reader.readTofFrame(0, tof_vec)) {
+        fail(filename, "the corrupt frame was read");
+      } else if (!reader.readTofFrame(2, tof_vec) || !sameTof(tof_vec, makeTofFrame(2))) {
+        fail(filename, "the intact frame after the corrupt frame differs from the written frame");
+      }
+    }
+  }
+
+  std::filesystem::remove_all(directory);
+
+  if (failures > 0) {
+    std::cout << failures << " failures" << std::endl;
+    return 1;
+  }
+  std::cout << "All measurement log checks passed" << std::endl;
+  return 0;
+}
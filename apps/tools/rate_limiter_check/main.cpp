@@ -0,0 +1,147 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Checks the suppression and the counting of the rate limiter and the verbosity threshold of LOG_RATE_LIMITED.
+ * @date 2026-10-17
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logger/LogMacros.hpp"
+#include "sensorring/logger/Logger.hpp"
+#include "sensorring/logger/LoggerClient.hpp"
+
+using namespace eduart;
+using namespace std::chrono_literals;
+
+static std::size_t failures = 0;
+
+void expect(const std::string& check, std::uint64_t value, std::uint64_t expected) {
+  if (value != expected) {
+    std::cout << "FAILED " << check << ": " << value << " instead of " << expected << std::endl;
+    failures++;
+  }
+}
+
+void expect(const std::string& check, const std::string& value, const std::string& expected) {
+  if (value != expected) {
+    std::cout << "FAILED " << check << ": \"" << value << "\" instead of \"" << expected << "\"" << std::endl;
+    failures++;
+  }
+}
+
+/**
+ * @class CountingClient
+ * @brief Counts the received messages and keeps the last one
+ */
+class CountingClient : public logger::LoggerClient {
+public:
+  void onOutputLog(logger::LogVerbosity, const std::string& msg) override {
+    received++;
+    last_msg = msg;
+  }
+
+  std::uint64_t received = 0;
+  std::string last_msg;
+};
+
+void checkSuppression() {
+  logger::RateLimiter limiter(100ms);
+  std::uint64_t suppressed = 99;
+
+  expect("first call allowed", limiter.allow(suppressed), true);
+  expect("nothing suppressed before the first call", suppressed, 0);
+  for (int i = 0; i < 3; i++) {
+    expect("call within the interval suppressed", limiter.allow(suppressed), false);
+  }
+
+  std::this_thread::sleep_for(120ms);
+  expect("call after the interval allowed", limiter.allow(suppressed), true);
+  expect("suppressed calls reported", suppressed, 3);
+
+  expect("annotation without suppressed messages", logger::RateLimiter::annotate("msg", 0), "msg");
+  expect("annotation with suppressed messages", logger::RateLimiter::annotate("msg", 3), "msg (suppressed 3 similar messages)");
+}
+
+void checkConcurrentCalls() {
+  static constexpr int THREADS = 4;
+  static constexpr int CALLS   = 20000;
+
+  // every call is either allowed or reported as suppressed by a later allowed call
+  logger::RateLimiter limiter(1ms);
+  std::atomic<std::uint64_t> allowed(0);
+  std::atomic<std::uint64_t> reported(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; t++) {
+    threads.emplace_back([&limiter, &allowed, &reported] {
+      for (int i = 0; i < CALLS; i++) {
+        std::uint64_t suppressed = 0;
+        if (limiter.allow(suppressed)) {
+          allowed++;
+          reported += suppressed;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::this_thread::sleep_for(5ms);
+  std::uint64_t suppressed = 0;
+  expect("call after the concurrent calls allowed", limiter.allow(suppressed), true);
+  expect("concurrent calls allowed or reported", allowed + reported + suppressed, THREADS * CALLS);
+}
+
+std::string countEvaluation(std::uint64_t& evaluated) {
+  evaluated++;
+  return "msg";
+}
+
+void checkThreshold() {
+  auto* logger = logger::Logger::getInstance();
+  CountingClient client;
+  std::uint64_t evaluated = 0;
+
+  logger->registerClient(&client, logger::LogVerbosity::Info);
+  LOG_RATE_LIMITED(logger::LogVerbosity::Debug, 0s, countEvaluation(evaluated));
+  expect("message below the threshold not evaluated", evaluated, 0);
+  expect("message below the threshold not received", client.received, 0);
+
+  for (int i = 0; i < 3; i++) {
+    LOG_RATE_LIMITED(logger::LogVerbosity::Warning, 1h, countEvaluation(evaluated));
+  }
+  expect("message of the same call site evaluated once", evaluated, 1);
+  expect("message of the same call site received once", client.received, 1);
+  expect("received message", client.last_msg, "msg");
+  logger->unregisterClient(&client);
+
+  // the one-argument overload passes every message, the threshold is off
+  logger->registerClient(&client);
+  client.received = 0;
+  LOG_RATE_LIMITED(logger::LogVerbosity::Debug, 0s, countEvaluation(evaluated));
+  expect("debug message evaluated without threshold", evaluated, 2);
+  expect("debug message received without threshold", client.received, 1);
+  logger->unregisterClient(&client);
+}
+
+int main(int, char*[]) {
+  checkSuppression();
+  checkConcurrentCalls();
+  checkThreshold();
+
+  if (failures > 0) {
+    std::cout << failures << " failures" << std::endl;
+    return 1;
+  }
+  std::cout << "All rate limiter checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Benchmark of the thermal image processing in frames per second on one core. No hardware is required.
+ * @date 2026-10-17
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/NullInterface.hpp"
+#include "common/ThermalTestData.hpp"
+#include "sensors/ThermalSensor.hpp"
+
+using namespace eduart;
+
+static constexpr std::size_t FRAME_COUNT   = 20000;
+static constexpr std::size_t WARMUP_FRAMES = 200;
+static constexpr std::size_t RAW_FRAMES    = 16;
+
+/**
+ * Decode frames with a thermal sensor that receives them through the dispatch of its interface, like on a bus
+ * @param[in] name name of the configuration
+ * @param[in] params parameters of the thermal sensor
+ * @param[in] frames raw frames that are decoded in turns
+ * @return false if a frame was not decoded
+ */
+bool runBenchmark(const std::string& name, sensor::ThermalSensorParams params, const std::vector<tools::ThermalRawFrame>& frames) {
+  tools::NullInterface interface;
+  sensor::ThermalSensor sensor(params, &interface, 0);
+  tools::sendThermalEeprom(interface, 0, tools::makeThermalEeprom(1));
+  if (!sensor.gotEEPROM()) {
+    std::cout << name << ": the EEPROM was not accepted" << std::endl;
+    return false;
+  }
+
+  auto decode = [&](std::size_t count) {
+    for (std::size_t i = 0; i < count; i++) {
+      sensor.clearDataFlag();
+      tools::sendThermalFrame(interface, 0, frames[i % frames.size()]);
+    }
+  };
+
+  decode(WARMUP_FRAMES);
+  const auto frames_before = sensor.getFrameCount();
+
+  const auto start = std::chrono::steady_clock::now();
+  decode(FRAME_COUNT);
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  const auto decoded = sensor.getFrameCount() - frames_before;
+  std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1);
+  std::cout << std::setw(10) << decoded / elapsed.count() << " frames/s";
+  std::cout << std::setw(10) << elapsed.count() * 1e6 / FRAME_COUNT << " us/frame";
+
+  // the temperatures of the last frame show that the frames were decoded with valid table look-ups
+  sensor.updateLatestMeasurement();
+  const auto& measurement = sensor.getLatestMeasurement().first;
+  std::cout << "    range " << measurement.min_deg_c << " ... " << measurement.max_deg_c << " deg C" << std::endl;
+
+  return decoded == FRAME_COUNT;
+}
+
+int main(int, char*[]) {
+  std::cout << "Decoding " << FRAME_COUNT << " thermal frames per configuration on one core";
+#ifdef SENSORRING_THERMAL_SINGLE_PRECISION
+  std::cout << " (single precision)" << std::endl;
+#else
+  std::cout << " (double precision)" << std::endl;
+#endif
+
+  const auto eeprom = tools::makeThermalEeprom(1);
+  std::mt19937 rng(2);
+  std::vector<tools::ThermalRawFrame> frames;
+  for (std::size_t i = 0; i < RAW_FRAMES; i++) {
+    frames.push_back(tools::makeThermalFrame(eeprom, rng));
+  }
+
+  sensor::ThermalSensorParams params;
+  params.enable       = true;
+  params.auto_min_max = true;
+  params.eeprom_dir   = std::filesystem::temp_directory_path().string();
+
+  bool success = true;
+
+  params.enable_grayscale_image  = false;
+  params.enable_falsecolor_image = false;
+  success &= runBenchmark("temperatures", params, frames);
+
+  params.enable_grayscale_image = true;
+  success &= runBenchmark("temperatures + grayscale", params, frames);
+
+  params.enable_falsecolor_image = true;
+  success &= runBenchmark("temperatures + all images", params, frames);
+
+  return success ? 0 : 1;
+}
@@ -0,0 +1,192 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Checks that the dispatched thermal kernels are bit-identical to the reference kernels on random and boundary inputs.
+ * @date 2026-10-17
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sensors/ThermalKernels.hpp"
+#include "sensors/hardware/heimann_htpa32.hpp"
+
+using namespace eduart;
+using namespace eduart::sensor;
+
+static constexpr std::size_t TRIALS          = 200;
+static constexpr std::size_t TABLE_SIZE      = NROFADELEMENTS * NROFTAELEMENTS;
+static const std::vector<std::size_t> LENGTHS = { 1024, 512, 32, 37, 3 };
+
+static std::size_t failures = 0;
+
+void fail(const std::string& kernel, const std::string& precision, const std::string& detail) {
+  if (failures < 20) {
+    std::cout << "MISMATCH " << kernel << "<" << precision << ">: " << detail << std::endl;
+  }
+  failures++;
+}
+
+template <typename T> bool sameBits(T a, T b) {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T> void checkCompensatePixels(const std::string& precision, std::mt19937& rng) {
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_real_distribution<double> gradient(-0.01, 0.01);
+  std::uniform_real_distribution<double> offset(-2000.0, 2000.0);
+
+  for (std::size_t trial = 0; trial < TRIALS; trial++) {
+    for (std::size_t len : { std::size_t(1024), std::size_t(512), std::size_t(256) }) {
+      std::vector<std::uint8_t> raw(len * 2), offsets(512);
+      std::vector<T> th_gradient(len), th_offset(len), vdd_comp(256), values(len), expected(len);
+      for (auto& value : raw)
+        value = static_cast<std::uint8_t>(byte(rng));
+      for (auto& value : offsets)
+        value = static_cast<std::uint8_t>(byte(rng));
+      for (std::size_t i = 0; i < len; i++) {
+        th_gradient[i] = static_cast<T>(gradient(rng));
+        th_offset[i]   = static_cast<T>(offset(rng));
+      }
+      for (auto& value : vdd_comp)
+        value = static_cast<T>(offset(rng));
+      const T ptat = static_cast<T>(20000 + trial * 100);
+
+      kernels::compensatePixels(raw.data(), offsets.data(), th_gradient.data(), th_offset.data(), vdd_comp.data(), ptat, len, values.data());
+      kernels::reference::compensatePixels(raw.data(), offsets.data(), th_gradient.data(), th_offset.data(), vdd_comp.data(), ptat, len, expected.data());
+
+      for (std::size_t i = 0; i < len; i++) {
+        if (!sameBits(values[i], expected[i])) {
+          fail("compensatePixels", precision, "len " + std::to_string(len) + " pixel " + std::to_string(i) + ": " + std::to_string(values[i]) + " != " + std::to_string(expected[i]));
+        }
+      }
+    }
+  }
+}
+
+template <typename T> void compareLookup(const std::string& precision, const std::string& input, const std::vector<T>& values, std::size_t table_col, std::int32_t dta) {
+  const std::size_t len = values.size();
+  std::vector<T> temps(len), expected(len);
+  T min_deg_c = 1e6, max_deg_c = 0, expected_min = 1e6, expected_max = 0;
+
+  const auto invalid          = kernels::lookupTemperatures(values.data(), table_col, dta, len, temps.data(), min_deg_c, max_deg_c);
+  const auto expected_invalid = kernels::reference::lookupTemperatures(values.data(), table_col, dta, len, expected.data(), expected_min, expected_max);
+
+  const std::string context = input + " col " + std::to_string(table_col) + " dta " + std::to_string(dta) + " len " + std::to_string(len);
+  if (invalid != expected_invalid) {
+    fail("lookupTemperatures", precision, context + ": " + std::to_string(invalid) + " != " + std::to_string(expected_invalid) + " invalid pixels");
+  }
+  if (!sameBits(min_deg_c, expected_min) || !sameBits(max_deg_c, expected_max)) {
+    fail("lookupTemperatures", precision, context + ": range " + std::to_string(min_deg_c) + " ... " + std::to_string(max_deg_c) + " != " + std::to_string(expected_min) + " ... " + std::to_string(expected_max));
+  }
+  for (std::size_t i = 0; i < len; i++) {
+    if (!sameBits(temps[i], expected[i])) {
+      fail("lookupTemperatures", precision, context + " value " + std::to_string(values[i]) + ": " + std::to_string(temps[i]) + " != " + std::to_string(expected[i]));
+    }
+  }
+}
+
+template <typename T> void checkLookupTemperatures(const std::string& precision, std::mt19937& rng) {
+  std::uniform_real_distribution<double> in_table(-TABLEOFFSET - 100.0, static_cast<double>(NROFADELEMENTS << ADEXPBITS));
+  std::uniform_int_distribution<std::int32_t> dta_dist(0, TAEQUIDISTANCE);
+
+  for (std::size_t table_col = 0; table_col < NROFTAELEMENTS; table_col++) {
+    // random values across the whole table and beyond both ends
+    for (std::size_t trial = 0; trial < TRIALS / 10; trial++) {
+      for (std::size_t len : LENGTHS) {
+        std::vector<T> values(len);
+        for (auto& value : values)
+          value = static_cast<T>(in_table(rng));
+        compareLookup(precision, "random", values, table_col, dta_dist(rng));
+      }
+    }
+
+    // values that are not finite or far out of range
+    const std::vector<T> special = { std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), T(-1e12), T(1e12), T(-TABLEOFFSET) - T(0.5), T(-TABLEOFFSET) - T(0.49), T(-TABLEOFFSET), T(-TABLEOFFSET) - T(1) };
+    for (std::size_t len : LENGTHS) {
+      std::vector<T> values(len);
+      for (std::size_t i = 0; i < len; i++)
+        values[i] = special[i % special.size()];
+      compareLookup(precision, "special", values, table_col, 0);
+      compareLookup(precision, "special", values, table_col, TAEQUIDISTANCE);
+    }
+
+    // Rows around the last row whose interpolation stays within the table for this column. Each row is hit at its
+    // edges, where rounding decides between two rows.
+    const std::size_t last_row = (TABLE_SIZE - NROFTAELEMENTS - 2 - table_col) / NROFTAELEMENTS;
+    std::vector<T> edges;
+    for (std::size_t row = last_row - 2; row <= last_row + 2; row++) {
+      const double start = static_cast<double>(row << ADEXPBITS) - TABLEOFFSET;
+      for (double delta : { -0.51, -0.5, -0.49, 0.0, 0.49, 0.5, 31.5, 63.49, 63.5 }) {
+        edges.push_back(static_cast<T>(start + delta));
+      }
+    }
+    // the same edges at the first rows of the table
+    for (std::size_t row = 0; row <= 2; row++) {
+      const double start = static_cast<double>(row << ADEXPBITS) - TABLEOFFSET;
+      for (double delta : { -0.51, -0.5, -0.49, 0.0, 0.49, 0.5, 63.49, 63.5 }) {
+        edges.push_back(static_cast<T>(start + delta));
+      }
+    }
+    for (std::int32_t dta : { 0, 1, TAEQUIDISTANCE / 2, TAEQUIDISTANCE - 1, TAEQUIDISTANCE }) {
+      compareLookup(precision, "row edges", edges, table_col, dta);
+    }
+  }
+}
+
+template <typename T> void checkNormalizeGrayscale(const std::string& precision, std::mt19937& rng) {
+  std::uniform_real_distribution<double> temperature(-60.0, 160.0);
+
+  for (std::size_t trial = 0; trial < TRIALS; trial++) {
+    const T t_min   = static_cast<T>(temperature(rng) / 4);
+    const T delta_t = static_cast<T>((trial % 2 == 0) ? 40.0 + trial : -40.0 - trial);
+    for (std::size_t len : LENGTHS) {
+      std::vector<T> temps(len);
+      for (auto& value : temps)
+        value = static_cast<T>(temperature(rng));
+      // temperatures that end exactly between two gray values
+      if (len > 2) {
+        temps[0] = t_min + delta_t * T(0.5) / T(255);
+        temps[1] = t_min + delta_t;
+        temps[2] = t_min;
+      }
+
+      std::vector<std::uint8_t> gray(len), expected(len);
+      kernels::normalizeGrayscale(temps.data(), t_min, delta_t, len, gray.data());
+      kernels::reference::normalizeGrayscale(temps.data(), t_min, delta_t, len, expected.data());
+
+      for (std::size_t i = 0; i < len; i++) {
+        if (gray[i] != expected[i]) {
+          fail("normalizeGrayscale", precision, "len " + std::to_string(len) + " temperature " + std::to_string(temps[i]) + ": " + std::to_string(gray[i]) + " != " + std::to_string(expected[i]));
+        }
+      }
+    }
+  }
+}
+
+int main(int, char*[]) {
+  std::cout << "Comparing the thermal kernels with the reference kernels, SIMD path " << (kernels::isAccelerated() ? "active" : "not available, the reference kernels are compared with themselves") << std::endl;
+
+  std::mt19937 rng(12345);
+  checkCompensatePixels<float>("float", rng);
+  checkCompensatePixels<double>("double", rng);
+  checkLookupTemperatures<float>("float", rng);
+  checkLookupTemperatures<double>("double", rng);
+  checkNormalizeGrayscale<float>("float", rng);
+  checkNormalizeGrayscale<double>("double", rng);
+
+  if (failures > 0) {
+    std::cout << failures << " mismatches" << std::endl;
+    return 1;
+  }
+  std::cout << "All kernels are bit-identical" << std::endl;
+  return 0;
+}
@@ -0,0 +1,158 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   main.cpp
+ * @author EduArt Robotik GmbH
+ * @brief  Checks that the single precision thermal processing stays within a fixed bound of the double precision processing.
+ * @date 2026-10-17
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "common/NullInterface.hpp"
+#include "common/ThermalTestData.hpp"
+#include "sensors/ThermalKernels.hpp"
+#include "sensors/ThermalSensor.hpp"
+
+using namespace eduart;
+using namespace eduart::sensor;
+
+static constexpr std::size_t FRAME_COUNT = 500;
+
+// Largest deviation of the compensated pixel values in ADC digits
+static constexpr double MAX_VALUE_ERROR = 0.01;
+
+// The look-up table truncates the compensated pixel values to whole digits. A value that lies next to a whole digit
+// may be truncated differently in single precision, one digit moves the temperature by up to two steps of 0.1 K.
+static constexpr double MAX_ERROR_DEG_C = 0.2 + 1e-4;
+
+// Share of the pixels whose temperature may deviate at all
+static constexpr double MAX_DEVIATING_SHARE = 1e-3;
+
+/**
+ * Temperatures of one frame in the given precision, computed in the same steps as ThermalSensor::processMeasurement
+ */
+template <typename T> struct Decoded {
+  std::array<T, NUMBER_OF_PIXEL> values;
+  std::array<T, NUMBER_OF_PIXEL> temp_deg_c;
+  T min_deg_c = 1e6;
+  T max_deg_c = 0;
+  std::size_t invalid = 0;
+};
+
+template <typename T> Decoded<T> decode(const htpa32::HTPA32Eeprom& eeprom, const tools::ThermalRawFrame& frame, std::uint16_t vdd, std::uint16_t ptat) {
+  const double grad_scale     = std::ldexp(1.0, -static_cast<int>(eeprom.grad_scale));
+  const double vddsc_gradient = std::ldexp(1.0, -static_cast<int>(eeprom.vddsc_gradient + eeprom.vddsc_offset));
+  const double vddsc_offset   = std::ldexp(1.0, -static_cast<int>(eeprom.vddsc_offset));
+
+  std::array<T, NUMBER_OF_PIXEL> th_gradient_coeff, th_offset_coeff;
+  for (std::size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
+    th_gradient_coeff[i] = static_cast<T>(eeprom.th_gradient[i] * grad_scale);
+    th_offset_coeff[i]   = static_cast<T>(eeprom.th_offset[i]);
+  }
+
+  const float t_ambient = ptat * eeprom.ptat_gradient + eeprom.ptat_offset;
+  std::size_t table_col = 0;
+  for (int j = 0; j < NROFTAELEMENTS; j++) {
+    if (t_ambient > htpa32::XTATemps[j]) {
+      table_col = j;
+    }
+  }
+  const std::int32_t dta = std::lround(t_ambient - htpa32::XTATemps[table_col]);
+
+  const double vdd_comp_val2 = (vdd - eeprom.vddth1 - ((double)(eeprom.vddth2 - eeprom.vddth1) / (eeprom.ptat_th2 - eeprom.ptat_th1)) * (ptat - eeprom.ptat_th1));
+  std::array<T, 256> vdd_comp;
+  for (std::size_t idx = 0; idx < vdd_comp.size(); idx++) {
+    vdd_comp[idx] = static_cast<T>((eeprom.vddcomp_gradient[idx] * vddsc_gradient * ptat + eeprom.vddcomp_offset[idx] * vddsc_offset) * vdd_comp_val2);
+  }
+
+  Decoded<T> result;
+  kernels::compensatePixels(frame.data() + 512, frame.data(), th_gradient_coeff.data(), th_offset_coeff.data(), vdd_comp.data(), static_cast<T>(ptat), NUMBER_OF_PIXEL, result.values.data());
+  result.invalid = kernels::lookupTemperatures(result.values.data(), table_col, dta, NUMBER_OF_PIXEL, result.temp_deg_c.data(), result.min_deg_c, result.max_deg_c);
+  return result;
+}
+
+int main(int, char*[]) {
+  const auto eeprom = tools::makeThermalEeprom(7);
+  std::mt19937 rng(8);
+  std::uniform_int_distribution<int> vdd_dist(30500, 32500);
+  std::uniform_int_distribution<int> ptat_dist(27000, 36000);
+
+  // the ThermalSensor of the library decodes the same frames in the precision it was built with
+  sensor::ThermalSensorParams params;
+  params.enable                  = true;
+  params.enable_grayscale_image  = false;
+  params.enable_falsecolor_image = false;
+  params.eeprom_dir              = std::filesystem::temp_directory_path().string();
+
+  tools::NullInterface interface;
+  sensor::ThermalSensor sensor(params, &interface, 0);
+  tools::sendThermalEeprom(interface, 0, eeprom);
+
+  double max_error       = 0;
+  double max_value_error = 0;
+  double sum_error       = 0;
+  std::size_t deviating  = 0;
+  std::size_t pixels     = 0;
+  std::size_t mismatches = 0;
+  bool success           = sensor.gotEEPROM();
+
+  for (std::size_t n = 0; n < FRAME_COUNT && success; n++) {
+    const auto frame = tools::makeThermalFrame(eeprom, rng);
+    const auto vdd   = static_cast<std::uint16_t>(vdd_dist(rng));
+    const auto ptat  = static_cast<std::uint16_t>(ptat_dist(rng));
+
+    const auto single_precision = decode<float>(eeprom, frame, vdd, ptat);
+    const auto double_precision = decode<double>(eeprom, frame, vdd, ptat);
+    if (single_precision.invalid != double_precision.invalid) {
+      std::cout << "Frame " << n << ": " << single_precision.invalid << " invalid pixels in single precision, " << double_precision.invalid << " in double precision" << std::endl;
+      success = false;
+    }
+
+    for (std::size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
+      const double error = std::abs(static_cast<double>(single_precision.temp_deg_c[i]) - double_precision.temp_deg_c[i]);
+      max_error          = std::max(max_error, error);
+      max_value_error    = std::max(max_value_error, std::abs(static_cast<double>(single_precision.values[i]) - double_precision.values[i]));
+      sum_error += error;
+      if (error > 0.05) {
+        deviating++;
+      }
+      pixels++;
+    }
+    max_error = std::max(max_error, std::abs(static_cast<double>(single_precision.min_deg_c) - double_precision.min_deg_c));
+    max_error = std::max(max_error, std::abs(static_cast<double>(single_precision.max_deg_c) - double_precision.max_deg_c));
+
+    // the computation above must match the library, otherwise the bound would be checked on the wrong steps
+    sensor.clearDataFlag();
+    tools::sendThermalFrame(interface, 0, frame, vdd, ptat);
+    sensor.updateLatestMeasurement();
+    const auto& measurement = sensor.getLatestMeasurement().first;
+    const auto expected     = decode<measurement::TemperatureScalar>(eeprom, frame, vdd, ptat);
+    if (std::memcmp(measurement.temp_data_deg_c.data.data(), expected.temp_deg_c.data(), sizeof(expected.temp_deg_c)) != 0) {
+      mismatches++;
+    }
+  }
+
+  if (mismatches > 0) {
+    std::cout << mismatches << " frames of the ThermalSensor differ from the computation of this check" << std::endl;
+    success = false;
+  }
+
+  const double deviating_share = pixels > 0 ? static_cast<double>(deviating) / pixels : 0.0;
+  std::cout << "Compared " << pixels << " pixels of " << FRAME_COUNT << " frames" << std::endl;
+  std::cout << "max error of the pixel values : " << max_value_error << " digits (bound " << MAX_VALUE_ERROR << ")" << std::endl;
+  std::cout << "max error of the temperatures : " << max_error << " K (bound " << MAX_ERROR_DEG_C << " K)" << std::endl;
+  std::cout << "deviating temperatures        : " << deviating_share * 100.0 << " % (bound " << MAX_DEVIATING_SHARE * 100.0 << " %)" << std::endl;
+  std::cout << "mean error of the temperatures: " << (pixels > 0 ? sum_error / pixels : 0.0) << " K" << std::endl;
+
+  success = success && max_value_error <= MAX_VALUE_ERROR && max_error <= MAX_ERROR_DEG_C && deviating_share <= MAX_DEVIATING_SHARE;
+  std::cout << (success ? "PASSED" : "FAILED") << std::endl;
+  return success ? 0 : 1;
+}
@@ -55,16 +55,21 @@ else:
 #include "sensorring/logger/Logger.hpp"
 #include "sensorring/logger/LoggerClient.hpp"
 #include "sensorring/platform/SensorringExport.hpp"
+#include "sensorring/types/EgoMotion.hpp"
 #include "sensorring/types/Image.hpp"
 #include "sensorring/types/LightMode.hpp"
 #include "sensorring/types/InterfaceType.hpp"
 #include "sensorring/types/PointCloud.hpp"
+#include "sensorring/types/PointCloudSoA.hpp"
+#include "sensorring/types/RingPointCloud.hpp"
+#include "sensorring/types/Statistics.hpp"
 #include "sensorring/types/TofMeasurement.hpp"
 #include "sensorring/types/ThermalMeasurement.hpp"
 #include "sensorring/math/Math.hpp"
 #include "sensorring/math/Vector3.hpp"
 #include "sensorring/math/Matrix3.hpp"
 #include "sensorring/MeasurementClient.hpp"
+#include "sensorring/MeasurementLog.hpp"
 #include "sensorring/MeasurementManager.hpp"
 #include "sensorring/Parameter.hpp"
 %}
@@ -116,6 +121,7 @@ typedef ::int64_t int64_t;
 
 // Type mappings for methods coping data to NumPy
 %apply (double*  INPLACE_ARRAY_FLAT, int DIM_FLAT) {(double*  buffer, int size)};
+%apply (float*   INPLACE_ARRAY_FLAT, int DIM_FLAT) {(float*   buffer, int size)};
 
 
 // Type mappings for methods coping data to NumPy
@@ -194,9 +200,30 @@ typedef ::int64_t int64_t;
 
 %template (PointDataVector) std::vector<eduart::measurement::PointData>;
 %include "sensorring/types/TofMeasurement.hpp"
+%include "sensorring/types/EgoMotion.hpp"
+
+
+%ignore eduart::measurement::GenericPointCloudSoA::data;
+%ignore eduart::measurement::GenericPointCloudSoA::x;
+%ignore eduart::measurement::GenericPointCloudSoA::y;
+%ignore eduart::measurement::GenericPointCloudSoA::z;
+%ignore eduart::measurement::GenericPointCloudSoA::distance;
+%ignore eduart::measurement::GenericPointCloudSoA::sigma;
+%ignore eduart::measurement::GenericPointCloudSoA::userIdx;
+%include "sensorring/types/PointCloudSoA.hpp"
+%template (PointCloudSoA) eduart::measurement::GenericPointCloudSoA<double>;
+%template (PointCloudSoAF) eduart::measurement::GenericPointCloudSoA<float>;
+
+
+%template (PointCloudRangeVector) std::vector<eduart::measurement::PointCloudRange>;
+%include "sensorring/types/RingPointCloud.hpp"
 
 %template (TemperatureImageTemplate) eduart::measurement::GenericGrayscaleImage<std::uint8_t, eduart::THERMAL_RESOLUTION>;
+#ifdef SENSORRING_THERMAL_SINGLE_PRECISION
+%template (GrayscaleImageTemplate) eduart::measurement::GenericGrayscaleImage<float, eduart::THERMAL_RESOLUTION>;
+#else
 %template (GrayscaleImageTemplate) eduart::measurement::GenericGrayscaleImage<double, eduart::THERMAL_RESOLUTION>;
+#endif
 %template (FalseColorImageTemplate) eduart::measurement::GenericRGBImage<std::uint8_t, eduart::THERMAL_RESOLUTION>;
 %include "sensorring/types/ThermalMeasurement.hpp"
 
@@ -219,6 +246,13 @@ typedef ::int64_t int64_t;
 
 
 %feature("director") eduart::manager::MeasurementClient;
+%template (LatencyBucketArray) std::array<std::uint64_t, 24>;
+%template (StateStatisticsVector) std::vector<eduart::manager::StateStatistics>;
+%template (SensorStatisticsVector) std::vector<eduart::manager::SensorStatistics>;
+%template (ClientStatisticsVector) std::vector<eduart::manager::ClientStatistics>;
+%include "sensorring/types/Statistics.hpp"
+
+
 %rename (ManagerStateToString) eduart::manager::toString(ManagerState);
 %template (TofMeasurementVector) std::vector<eduart::measurement::TofMeasurement>;
 %template (ThermalMeasurementVector) std::vector<eduart::measurement::ThermalMeasurement>;
@@ -235,6 +269,10 @@ typedef ::int64_t int64_t;
 %include "sensorring/MeasurementManager.hpp"
 
 
+%template (FrameIndexVector) std::vector<std::size_t>;
+%include "sensorring/MeasurementLog.hpp"
+
+
 %feature("director") eduart::logger::LoggerClient;
 %rename (LogVerbosityToString) toString(LogVerbosity);
 %include "sensorring/logger/LoggerClient.hpp"
@@ -8,8 +8,11 @@ option( SENSORRING_USE_USBTINGO "Compile with support for the USBtingo USB adapt
 option( SENSORRING_INSTALL "Enable the installation of the library." on)
 option( SENSORRING_BUILD_SHARED_LIBS "Build as shared library. If set to OFF a static library is built." OFF)
 option( SENSORRING_BUILD_EXAMPLES "Build the example programs" OFF)
+option( SENSORRING_BUILD_TOOLS "Build the benchmarks and checks of the library internals" OFF)
 option( SENSORRING_BUILD_DOCUMENTATION "Build the documentation" OFF)
 option( SENSORRING_BUILD_PYTHON_BINDINGS "Build python bindings" OFF)
+option( SENSORRING_THERMAL_SINGLE_PRECISION "Process thermal images in single precision" OFF)
+option( SENSORRING_ENABLE_TRACY "Instrument the library with Tracy profiling zones" OFF)
 
 if(IS_WINDOWS)
   set( SENSORRING_USE_USBTINGO ON)
@@ -34,4 +34,23 @@ if(SENSORRING_USE_USBTINGO)
   endif()
 endif()
 
+if(SENSORRING_ENABLE_TRACY)
+  find_package(Tracy QUIET)
+
+  if(NOT Tracy_FOUND)
+    message(STATUS "Did not find Tracy. Fetching it from GitHub...")
+
+    include(FetchContentCompat)
+    fetchcontent_declare_compat(
+      tracy
+      URL https://github.com/wolfpld/tracy/archive/refs/tags/v0.11.1.zip
+    )
+
+    set(TRACY_ENABLE ON)
+    set(TRACY_ON_DEMAND ON)
+
+    FetchContent_MakeAvailable(tracy)
+  endif()
+endif()
+
 find_package(Threads REQUIRED)
\ No newline at end of file
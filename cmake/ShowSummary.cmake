@@ -20,6 +20,7 @@ message(STATUS " __________________________ OPTIONS __________________________")
 message(STATUS " SENSORRING_INSTALL                          : " ${SENSORRING_INSTALL})
 message(STATUS " SENSORRING_BUILD_SHARED_LIBS                : " ${SENSORRING_BUILD_SHARED_LIBS})
 message(STATUS " SENSORRING_BUILD_EXAMPLES                   : " ${SENSORRING_BUILD_EXAMPLES})
+message(STATUS " SENSORRING_BUILD_TOOLS                      : " ${SENSORRING_BUILD_TOOLS})
 if(CMAKE_BUILD_TYPE MATCHES Release)
 message(STATUS " SENSORRING_BUILD_DOCUMENTATION              : " ${SENSORRING_BUILD_DOCUMENTATION})
 message(STATUS " SENSORRING_BUILD_PYTHON_BINDINGS            : " ${SENSORRING_BUILD_PYTHON_BINDINGS})
@@ -28,6 +29,8 @@ if(IS_LINUX)
 message(STATUS " SENSORRING_USE_SOCKETCAN                    : " ${SENSORRING_USE_SOCKETCAN})
 endif()
 message(STATUS " SENSORRING_USE_USBTINGO                     : " ${SENSORRING_USE_USBTINGO})
+message(STATUS " SENSORRING_THERMAL_SINGLE_PRECISION         : " ${SENSORRING_THERMAL_SINGLE_PRECISION})
+message(STATUS " SENSORRING_ENABLE_TRACY                     : " ${SENSORRING_ENABLE_TRACY})
 message(STATUS "")
 
 message(STATUS " _________________________ PLATFORM __________________________")
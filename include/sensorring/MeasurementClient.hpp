@@ -13,6 +13,8 @@
 #include <string>
 
 #include "sensorring/platform/SensorringExport.hpp"
+#include "sensorring/types/PointCloudSoA.hpp"
+#include "sensorring/types/RingPointCloud.hpp"
 #include "sensorring/types/ThermalMeasurement.hpp"
 #include "sensorring/types/TofMeasurement.hpp"
 
@@ -79,6 +81,17 @@ class SENSORRING_API MeasurementClient {
    */
   virtual void onTransformedTofMeasurement([[maybe_unused]] const std::vector<measurement::TofMeasurement>& measurement_vec) {};
 
+  /**
+   * Callback method for new Time-of-Flight sensor measurements. Returns the
+   * transformed measurements of all sensors merged into a single point cloud.
+   * The referenced buffer is reused for the next measurement, copy it if it
+   * is needed after the callback returns. Only called if the client was
+   * registered with MeasurementManager::registerClient(client, true).
+   * @param[in] point_cloud the most recent Time-of-Flight sensor measurements
+   * in the common transformed coordinate frame
+   */
+  virtual void onRingPointCloud([[maybe_unused]] const measurement::RingPointCloud& point_cloud) {};
+
   /**
    * Callback method for new thermal sensor measurements. Returns a
    * vector of the measurements from all sensors.
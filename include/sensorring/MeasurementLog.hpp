@@ -0,0 +1,220 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   MeasurementLog.hpp
+ * @author EduArt Robotik GmbH
+ * @brief  Writer and reader of indexed binary logs of decoded measurements
+ * @date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sensorring/MeasurementClient.hpp"
+#include "sensorring/platform/SensorringExport.hpp"
+#include "sensorring/types/ThermalMeasurement.hpp"
+#include "sensorring/types/TofMeasurement.hpp"
+
+namespace eduart {
+
+namespace filemanager {
+
+// Forward declaration of implementation classes
+class SENSORRING_API MeasurementLogWriterImpl;
+class SENSORRING_API MeasurementLogReaderImpl;
+
+/**
+ * @enum LogFrameType
+ * @brief Type of the measurements stored in a frame of a measurement log
+ */
+enum class SENSORRING_API LogFrameType : std::uint32_t {
+  Invalid = 0,
+  Tof     = 1,
+  Thermal = 2
+};
+
+/**
+ * @class MeasurementLogWriter
+ * @brief Writes decoded measurements to an indexed binary log. Every call of the write methods appends one frame, which
+ * holds the measurements of all sensors of one measurement cycle. The calling thread only serializes the measurements,
+ * a writer thread collects the frames in chunks of up to 4 MiB or one second that are written to the file at once. If
+ * the writer thread falls behind by more than 64 frames, new frames are dropped and the write methods return false.
+ * When the log is closed, an index of all frames, a time index and an index of the measurement frame ids are appended.
+ * If the process ends before, the reader rebuilds the index from the chunks that were written completely. The writer is
+ * also a MeasurementClient, when it is registered with the MeasurementManager it logs the transformed Time-of-Flight
+ * and the thermal measurements.
+ */
+class SENSORRING_API MeasurementLogWriter : public manager::MeasurementClient {
+public:
+  /**
+   * Constructor
+   */
+  MeasurementLogWriter();
+
+  /**
+   * Destructor, closes the log file
+   */
+  ~MeasurementLogWriter() noexcept;
+
+  /**
+   * Create a new log file. An existing file is overwritten.
+   * @param[in] filepath directory of the log file, relative paths are resolved against the home directory
+   * @param[in] filename name of the log file
+   * @return true on success
+   */
+  bool open(const std::string filepath, const std::string filename) noexcept;
+
+  /**
+   * Create a new log file in the home directory. An existing file is overwritten.
+   * @param[in] filename name of the log file
+   * @return true on success
+   */
+  bool open(const std::string filename) noexcept;
+
+  /**
+   * Write the queued frames, the last chunk and the index and close the log file
+   */
+  void close() noexcept;
+
+  /**
+   * Check if a log file is open
+   * @return true if a log file is open
+   */
+  bool isOpen() const noexcept;
+
+  /**
+   * Append a frame of Time-of-Flight measurements. Thread safe.
+   * @param[in] measurement_vec measurements of one measurement cycle
+   * @return true if the frame was queued for writing
+   */
+  bool writeTofMeasurement(const std::vector<measurement::TofMeasurement>& measurement_vec) noexcept;
+
+  /**
+   * Append a frame of thermal measurements. Thread safe.
+   * @param[in] measurement_vec measurements of one measurement cycle
+   * @return true if the frame was queued for writing
+   */
+  bool writeThermalMeasurement(const std::vector<measurement::ThermalMeasurement>& measurement_vec) noexcept;
+
+  /**
+   * Get the number of frames queued for the current log file
+   * @return number of frames
+   */
+  std::size_t getFrameCount() const noexcept;
+
+  void onTransformedTofMeasurement(const std::vector<measurement::TofMeasurement>& measurement_vec) override;
+
+  void onThermalMeasurement(const std::vector<measurement::ThermalMeasurement>& measurement_vec) override;
+
+private:
+  std::unique_ptr<MeasurementLogWriterImpl> _writer_impl;
+};
+
+/**
+ * @class MeasurementLogReader
+ * @brief Random access reader of the logs written by the MeasurementLogWriter. The log file is memory-mapped and only
+ * the index is read when the file is opened. Frames are decoded on request, either by their index in the log, by their
+ * time stamp or by the frame id of their measurements. The time stamp of a frame is the receive time of the last CAN frame of its newest measurement.
+ */
+class SENSORRING_API MeasurementLogReader {
+public:
+  /**
+   * Constructor
+   */
+  MeasurementLogReader();
+
+  /**
+   * Destructor, closes the log file
+   */
+  ~MeasurementLogReader() noexcept;
+
+  /**
+   * Open a log file
+   * @param[in] filepath directory of the log file, relative paths are resolved against the home directory
+   * @param[in] filename name of the log file
+   * @return true if the file is a valid measurement log
+   */
+  bool open(const std::string filepath, const std::string filename) noexcept;
+
+  /**
+   * Open a log file in the home directory
+   * @param[in] filename name of the log file
+   * @return true if the file is a valid measurement log
+   */
+  bool open(const std::string filename) noexcept;
+
+  /**
+   * Close the log file
+   */
+  void close() noexcept;
+
+  /**
+   * Check if a log file is open
+   * @return true if a log file is open
+   */
+  bool isOpen() const noexcept;
+
+  /**
+   * Get the number of frames of the log
+   * @return number of frames
+   */
+  std::size_t getFrameCount() const noexcept;
+
+  /**
+   * Get the type of a frame
+   * @param[in] frame_idx index of the frame in the log
+   * @return type of the frame, Invalid if the index is out of range
+   */
+  LogFrameType getFrameType(std::size_t frame_idx) const noexcept;
+
+  /**
+   * Get the time stamp of a frame
+   * @param[in] frame_idx index of the frame in the log
+   * @return time stamp in nanoseconds since the epoch (system clock), 0 if the index is out of range
+   */
+  std::uint64_t getFrameTimestamp(std::size_t frame_idx) const noexcept;
+
+  /**
+   * Find all frames within a time range
+   * @param[in] begin_ns start of the time range in nanoseconds since the epoch (system clock), inclusive
+   * @param[in] end_ns end of the time range in nanoseconds since the epoch (system clock), exclusive
+   * @return indices of the frames sorted by their time stamps
+   */
+  std::vector<std::size_t> findFrames(std::uint64_t begin_ns, std::uint64_t end_ns) const noexcept;
+
+  /**
+   * Find all frames that hold a measurement with a frame id. The frame ids of the sensors wrap around, so long logs
+   * may hold several frames with the same id.
+   * @param[in] type type of the measurements
+   * @param[in] frame_id frame id of the measurement
+   * @return indices of the frames in the order of the log
+   */
+  std::vector<std::size_t> findFramesById(LogFrameType type, std::uint32_t frame_id) const noexcept;
+
+  /**
+   * Decode a frame of Time-of-Flight measurements
+   * @param[in] frame_idx index of the frame in the log
+   * @param[out] measurement_vec measurements of the frame
+   * @return true on success, false if the index is out of range or the frame has another type
+   */
+  bool readTofFrame(std::size_t frame_idx, std::vector<measurement::TofMeasurement>& measurement_vec) const noexcept;
+
+  /**
+   * Decode a frame of thermal measurements
+   * @param[in] frame_idx index of the frame in the log
+   * @param[out] measurement_vec measurements of the frame
+   * @return true on success, false if the index is out of range or the frame has another type
+   */
+  bool readThermalFrame(std::size_t frame_idx, std::vector<measurement::ThermalMeasurement>& measurement_vec) const noexcept;
+
+private:
+  std::unique_ptr<MeasurementLogReaderImpl> _reader_impl;
+};
+
+} // namespace filemanager
+
+} // namespace eduart
@@ -14,7 +14,9 @@
 #include "sensorring/MeasurementClient.hpp"
 #include "sensorring/Parameter.hpp"
 #include "sensorring/platform/SensorringExport.hpp"
+#include "sensorring/types/EgoMotion.hpp"
 #include "sensorring/types/LightMode.hpp"
+#include "sensorring/types/Statistics.hpp"
 
 namespace eduart {
 
@@ -70,6 +72,14 @@ class SENSORRING_API MeasurementManager {
    */
   void registerClient(MeasurementClient* observer) noexcept;
 
+  /**
+   * Register an observer with the MeasurementManager object and choose whether it receives the merged ring point cloud.
+   * The ring point cloud is only built while at least one registered observer receives it.
+   * @param[in] observer Observer that is registered and gets notified on future events
+   * @param[in] ring_point_cloud true if the onRingPointCloud callback of the observer is called
+   */
+  void registerClient(MeasurementClient* observer, bool ring_point_cloud) noexcept;
+
   /**
    * Unregister an observer with the MeasurementManager object
    * @param[in] observer Observer that is unregistered and will not be notified on future events
@@ -128,6 +138,22 @@ class SENSORRING_API MeasurementManager {
    */
   void setLight(light::LightMode mode, std::uint8_t red = 0, std::uint8_t green = 0, std::uint8_t blue = 0) noexcept;
 
+  /**
+   * Add an ego-motion sample, e.g. from the odometry of the robot. Once samples are pushed, the transformed
+   * Time-of-Flight measurements are motion compensated to the receive time of the newest measurement of each cycle.
+   * Samples must be pushed in chronological order and should cover the time of the measurements.
+   * @param[in] motion velocity of the robot in the coordinate frame of the sensor ring
+   */
+  void pushEgoMotion(const measurement::EgoMotion& motion) noexcept;
+
+  /**
+   * Get a snapshot of the runtime statistics, e.g. the time spent in each state, the latencies of the sensors and the
+   * number of timeouts. The statistics are recorded with lock-free counters and can be queried at any time. The
+   * snapshot allocates the per sensor and per client entries and throws std::bad_alloc if that fails.
+   * @return statistics accumulated since the construction of the MeasurementManager
+   */
+  Statistics getStatistics() const;
+
 private:
   std::unique_ptr<MeasurementManagerImpl> _mm_impl;
 };
@@ -31,6 +31,15 @@ enum class SENSORRING_API Orientation {
   none
 };
 
+/**
+ * @enum TofResolution
+ * @brief Zone resolution of the Time-of-Flight point clouds. The sensors always measure 8x8 zones, lower resolutions are binned on the host.
+ */
+enum class SENSORRING_API TofResolution {
+  res_8x8,
+  res_4x4
+};
+
 /**
  * @struct LightParams
  * @brief Parameter structure of the sensor lights of a sensor board. Not all sensor boards have lights.
@@ -63,6 +72,12 @@ struct SENSORRING_API ThermalSensorParams {
   /// Enable automatic color scaling of the thermal images using the coldest and the hottest temperature in each image.
   bool auto_min_max = false;
 
+  /// Generate the grayscale image of each measurement. Disable it to save processing time if only the temperatures are used.
+  bool enable_grayscale_image = true;
+
+  /// Generate the false color image of each measurement. Disable it to save processing time if only the temperatures are used.
+  bool enable_falsecolor_image = true;
+
   /// Save the thermal sensors eeprom content to a local file to only require a transfer once.
   bool use_eeprom_file = false;
 
@@ -89,6 +104,9 @@ struct SENSORRING_API TofSensorParams {
 
   /// Enable time of flight measurements from this sensor.
   bool enable = false;
+
+  /// Zone resolution of the point cloud. With 4x4 zones each point averages the valid distances of 2x2 measured zones, which gives less points with less noise at the same measurement rate.
+  TofResolution resolution = TofResolution::res_8x8;
 };
 
 /**
@@ -116,6 +134,50 @@ struct SENSORRING_API SensorBoardParams {
 
 namespace bus {
 
+/**
+ * @struct SimulationParams
+ * @brief Parameter structure of a simulated communication interface. The simulated interface emulates the firmware of
+ * a number of sensor boards and replaces the hardware for tests and benchmarks.
+ */
+struct SENSORRING_API SimulationParams {
+  /// Number of emulated sensor boards. If set to 0 one board is emulated for every configured board of the bus.
+  unsigned int board_count = 0;
+
+  /// Integration time of a Time-of-Flight measurement with 8x8 zones in microseconds.
+  unsigned int tof_integration_time_us = 66000;
+
+  /// Transmission time of a single frame in microseconds. All boards share the bus, so frames are sent one after another.
+  unsigned int frame_time_us = 100;
+
+  /// Maximal random deviation of the integration time in microseconds.
+  unsigned int jitter_us = 0;
+
+  /// Probability that a measurement frame sent by a sensor board is lost. The configuration traffic, i.e. the enumeration and the thermal EEPROM, is never faulted.
+  double drop_probability = 0.0;
+
+  /// Probability that a measurement frame sent by a sensor board is received twice, which corrupts the measurement.
+  double duplicate_probability = 0.0;
+
+  /// Probability that a sensor board ignores a measurement command.
+  double mute_probability = 0.0;
+
+  /// Seed of the random number generator for jitter and fault injection.
+  unsigned int seed = 0;
+};
+
+/**
+ * @struct ReplayParams
+ * @brief Parameter structure of a replay interface. The replay interface plays back a log file that was recorded on a
+ * real interface and feeds the recorded frames through the normal decoding path.
+ */
+struct SENSORRING_API ReplayParams {
+  /// Path of the recorded log file.
+  std::string log_file;
+
+  /// If set to true the frames are replayed with their recorded timing. If set to false the frames are replayed as fast as the measurement pipeline requests them.
+  bool real_time = true;
+};
+
 /**
  * @struct BusParams
  * @brief Parameter structure of a communication bus. A bus is one communication
@@ -128,8 +190,20 @@ struct SENSORRING_API BusParams {
   /// Type of the communication interface. Only interface types that are defined in com::InterfaceType are currently supported.
   com::InterfaceType type = com::InterfaceType::UNDEFINED;
 
+  /// Minimal time between two frames sent on this communication interface in microseconds. If set to 0 queued frames are sent back to back. Only used by SocketCAN interfaces.
+  unsigned int tx_frame_gap_us = 2000;
+
   /// Parameters of the sensor boards that are connected through this communication interface. Each element belongs to a unique sensor board.
   std::vector<sensor::SensorBoardParams> board_param_vec;
+
+  /// Behavior of the emulated sensor boards. Only used by simulated interfaces.
+  SimulationParams simulation;
+
+  /// Playback of a recorded log file. Only used by replay interfaces.
+  ReplayParams replay;
+
+  /// If not empty, all frames sent and received on this communication interface are recorded to this file. An existing file is overwritten.
+  std::string record_file;
 };
 
 } // namespace bus
@@ -173,9 +247,15 @@ struct SENSORRING_API ManagerParams {
   /// If set to true the MeasurementManager will only start when the configured topology matches the actual connected devices. If set to false the MeasurementManager will still start but only use the properly configured sensors.
   bool enforce_topology = false;
 
-  /// Target frequency for the time of flight measurement. If set to 0.0 the measurements are executed as fast as possible.
+  /// If set to true and the sensor ring has more than one communication interface, each interface is measured by its own thread with independent timing and error recovery. The measurements of all interfaces are combined into one frame before they are passed to the clients. If an interface does not deliver in time, the frame is passed on with the measurements of the remaining interfaces. Only used by startMeasuring().
+  bool parallel_buses = false;
+
+  /// Target frequency for the time of flight measurement. If set to 0.0 the measurements are executed as fast as possible. Higher frequencies than the maximum rate of the sensors are limited to that rate.
   double frequency_tof_hz = 0.0;
 
+  /// If set to true the next time of flight measurement is requested before the previous one is fetched, so that the sensor integration overlaps the data transfer. This is always the case if frequency_tof_hz is set to 0.0. With a target frequency the published measurements are delayed by one period.
+  bool pipeline_tof_measurements = false;
+
   /// Target frequency for the thermal measurement. If set to 0.0 the measurements are executed as fast as possible.
   double frequency_thermal_hz = 1.0;
 
@@ -9,10 +9,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include "sensorring/logger/LoggerClient.hpp"
 #include "sensorring/platform/SensorringExport.hpp"
@@ -21,6 +26,19 @@ namespace eduart {
 
 namespace logger {
 
+// Forward declaration of the message queue of the asynchronous mode
+class LogQueue;
+
+/**
+ * @enum LogOverflowPolicy
+ * @brief Behavior of the asynchronous Logger when the message queue is full
+ */
+enum class SENSORRING_API LogOverflowPolicy {
+  DropNewest, ///< Discard the new message
+  DropOldest, ///< Discard the oldest queued message to make room for the new one
+  Block       ///< Wait until the logger thread made room for the new message
+};
+
 /**
  * @class Logger
  * @brief Centralized class to collect all log messages and relay them to the registered observers. The Logger is implemented as a singleton.
@@ -28,7 +46,7 @@ namespace logger {
 class SENSORRING_API Logger {
 public:
   /// Destructor
-  ~Logger() = default;
+  ~Logger();
 
   /**
    * @brief Get a reference to the instance of the Logger singleton
@@ -37,11 +55,20 @@ class SENSORRING_API Logger {
   static Logger* getInstance() noexcept;
 
   /**
-   * @brief Register a new LoggerClient to be notified of future log messages
+   * @brief Register a new LoggerClient to be notified of all future log messages including debug messages. As long as
+   * the client is registered, no message is filtered out before it is formatted. Prefer the overload with a verbosity.
    * @param[in] client LoggerClient that will be registered
    */
   void registerClient(LoggerClient* client) noexcept;
 
+  /**
+   * @brief Register a new LoggerClient to be notified of future log messages at or above a verbosity. Messages below
+   * the lowest verbosity of all registered clients are discarded before they are formatted.
+   * @param[in] client LoggerClient that will be registered
+   * @param[in] min_verbosity Lowest verbosity of the messages that are passed to the client
+   */
+  void registerClient(LoggerClient* client, LogVerbosity min_verbosity) noexcept;
+
   /**
    * @brief Unregister a new LoggerClient to no longer be notified of log messages
    * @param[in] client LoggerClient that will be unregistered
@@ -64,14 +91,72 @@ class SENSORRING_API Logger {
    */
   void log(const LogVerbosity verbosity, const std::stringstream& msg) const;
 
+  /**
+   * @brief Check if a message of the given verbosity is received by any registered client. Exceptions are always
+   * enabled because they are thrown even without clients.
+   * @param[in] verbosity Log verbosity of the message
+   * @return true if the message should be formatted and logged
+   */
+  bool isEnabled(const LogVerbosity verbosity) const noexcept;
+
+  /**
+   * @brief Switch to the asynchronous mode. The log methods only push the messages into a bounded lock-free queue and
+   * return, a separate thread relays the messages to the registered clients. Slow clients then no longer stall the
+   * threads that log, e.g. the CAN listeners. Exceptions are still thrown on the logging thread.
+   * @param[in] capacity Number of messages the queue can hold
+   * @param[in] policy Behavior when the queue is full
+   * @return true on success, false if the asynchronous mode is already running
+   */
+  bool startAsync(std::size_t capacity = 4096, LogOverflowPolicy policy = LogOverflowPolicy::DropNewest) noexcept;
+
+  /**
+   * @brief Relay all queued messages and switch back to the synchronous mode
+   */
+  void stopAsync() noexcept;
+
+  /**
+   * @brief Check if the asynchronous mode is running
+   * @return true if the asynchronous mode is running
+   */
+  bool isAsync() const noexcept;
+
+  /**
+   * @brief Get the number of messages that were discarded because the queue of the asynchronous mode was full
+   * @return number of dropped messages since the start of the program
+   */
+  std::uint64_t getDroppedMessageCount() const noexcept;
+
 private:
   /// Private constructor. The Logger is a singleton.
-  Logger() = default;
+  Logger();
+
+  void enqueue(const LogVerbosity verbosity, std::string msg) const;
+
+  void deliver(const LogVerbosity verbosity, const std::string& msg) const;
+
+  void updateMinVerbosity();
+
+  void asyncWorker(std::shared_ptr<LogQueue> queue) const;
 
   mutable std::recursive_mutex _client_mutex;
   using LockGuard = std::lock_guard<std::recursive_mutex>;
 
-  std::set<logger::LoggerClient*> _clients;
+  // Registered clients and the lowest verbosity they receive
+  std::map<logger::LoggerClient*, LogVerbosity> _clients;
+
+  // Lowest verbosity of all registered clients
+  std::atomic<int> _min_verbosity;
+
+  // Queue of the asynchronous mode, accessed with std::atomic_load and std::atomic_store
+  std::shared_ptr<LogQueue> _queue;
+
+  std::mutex _async_mutex;
+
+  std::thread _async_thread;
+
+  mutable std::atomic<std::uint64_t> _dropped_messages;
+
+  mutable std::uint64_t _reported_dropped_messages;
 };
 
 } // namespace logger
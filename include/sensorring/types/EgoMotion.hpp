@@ -0,0 +1,39 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   EgoMotion.hpp
+ * @author EduArt Robotik GmbH
+ * @brief  Motion sample of the robot used for the motion compensation of the point clouds
+ * @date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "sensorring/math/Math.hpp"
+#include "sensorring/platform/SensorringExport.hpp"
+
+namespace eduart {
+
+namespace measurement {
+
+/**
+ * @class  EgoMotion
+ * @brief  Velocity of the robot at a point in time. The velocities are expressed in the coordinate frame of the sensor
+ *         ring, i.e. the frame of the transformed Time-of-Flight measurements.
+ */
+struct SENSORRING_API EgoMotion {
+  /// Time of the sample in nanoseconds since the epoch (system clock)
+  std::uint64_t timestamp_ns = 0;
+
+  /// Linear velocity in m/s
+  math::Vector3 linear_velocity = { 0.0, 0.0, 0.0 };
+
+  /// Angular velocity around the x, y and z axis in rad/s
+  math::Vector3 angular_velocity = { 0.0, 0.0, 0.0 };
+};
+
+} // namespace measurement
+
+} // namespace eduart
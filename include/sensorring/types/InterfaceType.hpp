@@ -18,7 +18,9 @@ namespace com {
 enum class SENSORRING_API InterfaceType {
   UNDEFINED,
   SOCKETCAN,
-  USBTINGO
+  USBTINGO,
+  SIMULATED,
+  REPLAY
 };
 
 } // namespace com
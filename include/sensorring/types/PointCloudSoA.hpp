@@ -0,0 +1,136 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   PointCloudSoA.hpp
+ * @author EduArt Robotik GmbH
+ * @brief  Structure-of-arrays point cloud type
+ * @date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "sensorring/platform/SensorringExport.hpp"
+#include "sensorring/types/PointCloud.hpp"
+#include "sensorring/types/TofMeasurement.hpp"
+
+namespace eduart {
+
+namespace measurement {
+
+/**
+ * @class  GenericPointCloudSoA
+ * @brief  Point cloud stored as structure of arrays. The columns x, y, z, raw distance, sigma and user index are kept
+ *         back to back in one contiguous allocation. Each column starts at a multiple of stride() and holds size()
+ *         valid values, so a column can be passed directly to vectorized code.
+ */
+template <typename T> class SENSORRING_API GenericPointCloudSoA {
+  static_assert(std::is_floating_point<T>::value, "T must be a floating point type");
+
+public:
+  /// Number of columns of the point cloud
+  static constexpr std::size_t COLUMNS = 6;
+
+  /**
+   * @brief Number of points in the point cloud
+   * @return point count
+   */
+  std::size_t size() const { return _size; }
+
+  /**
+   * @brief Distance between the beginnings of two consecutive columns in elements
+   * @return column stride
+   */
+  std::size_t stride() const { return _stride; }
+
+  /**
+   * @brief Check if the point cloud is empty
+   * @return true if there are no points
+   */
+  bool empty() const { return _size == 0; }
+
+  /**
+   * @brief Remove all points without releasing the allocated memory
+   */
+  void clear() { _size = 0; }
+
+  /**
+   * @brief Make sure that the point cloud can hold the requested number of points without reallocation
+   * @param[in] count number of points
+   */
+  void reserve(std::size_t count);
+
+  /**
+   * @brief Change the number of points. New points are zero initialized.
+   * @param[in] count number of points
+   */
+  void resize(std::size_t count);
+
+  /**
+   * @brief Replace the content with the points of all given measurements
+   * @param[in] measurement_vec Time-of-Flight measurements to be combined
+   */
+  void assign(const std::vector<TofMeasurement>& measurement_vec);
+
+  /**
+   * @brief Append the points of a point cloud
+   * @param[in] point_cloud point cloud to be appended
+   */
+  void append(const PointCloud& point_cloud);
+
+  /**
+   * @brief Copies the point cloud column wise to a buffer
+   * @param[in] buffer Pointer to the buffer. Make sure it has sufficient size.
+   * @param[in] size Actual size of the buffer passed to the method. If the buffer is smaller than COLUMNS * size() only a subset of points is copied. The columns are packed back to back with a stride of size / COLUMNS.
+   */
+  void copyTo(T* buffer, int size) const;
+
+  /// Pointer to the beginning of the contiguous allocation
+  T* data() { return _data.data(); }
+  const T* data() const { return _data.data(); }
+
+  /// Column of the x coordinates
+  T* x() { return column(0); }
+  const T* x() const { return column(0); }
+
+  /// Column of the y coordinates
+  T* y() { return column(1); }
+  const T* y() const { return column(1); }
+
+  /// Column of the z coordinates
+  T* z() { return column(2); }
+  const T* z() const { return column(2); }
+
+  /// Column of the raw distances
+  T* distance() { return column(3); }
+  const T* distance() const { return column(3); }
+
+  /// Column of the standard deviations
+  T* sigma() { return column(4); }
+  const T* sigma() const { return column(4); }
+
+  /// Column of the user assigned sensor indices
+  T* userIdx() { return column(5); }
+  const T* userIdx() const { return column(5); }
+
+private:
+  T* column(std::size_t idx) { return _data.data() + idx * _stride; }
+  const T* column(std::size_t idx) const { return _data.data() + idx * _stride; }
+
+  std::vector<T> _data;
+  std::size_t _size   = 0;
+  std::size_t _stride = 0;
+};
+
+/// Double precision structure-of-arrays point cloud
+using PointCloudSoA = GenericPointCloudSoA<double>;
+
+/// Single precision structure-of-arrays point cloud
+using PointCloudSoAF = GenericPointCloudSoA<float>;
+
+} // namespace measurement
+
+} // namespace eduart
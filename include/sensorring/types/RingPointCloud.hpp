@@ -0,0 +1,70 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   RingPointCloud.hpp
+ * @author EduArt Robotik GmbH
+ * @brief  Merged point cloud of all Time-of-Flight sensors of the ring
+ * @date   2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sensorring/platform/SensorringExport.hpp"
+#include "sensorring/types/PointCloudSoA.hpp"
+#include "sensorring/types/TofMeasurement.hpp"
+
+namespace eduart {
+
+namespace measurement {
+
+/**
+ * @class  PointCloudRange
+ * @brief  Range of the points within a RingPointCloud that were measured by a single sensor
+ */
+struct SENSORRING_API PointCloudRange {
+  /// User assigned index of the sensor that measured the points
+  int user_idx = 0;
+
+  /// Frame number of the sensor measurement
+  unsigned int frame_id = 0;
+
+  /// Receive time of the last CAN frame of the sensor measurement in nanoseconds since the epoch
+  std::uint64_t last_rx_timestamp_ns = 0;
+
+  /// Index of the first point of the sensor
+  std::size_t offset = 0;
+
+  /// Number of points of the sensor
+  std::size_t count = 0;
+};
+
+/**
+ * @class  RingPointCloud
+ * @brief  Transformed Time-of-Flight measurements of all sensors merged into a single point cloud
+ */
+struct SENSORRING_API RingPointCloud {
+  /// Time of the point cloud in nanoseconds since the epoch of the system clock. This is the reference time of the
+  /// motion compensation if ego-motion samples are pushed, otherwise the time of the merge.
+  std::uint64_t timestamp_ns = 0;
+
+  /// Points of all sensors
+  PointCloudSoA point_cloud;
+
+  /// Ranges of the points of the individual sensors
+  std::vector<PointCloudRange> ranges;
+
+  /**
+   * @brief Replace the content with the points of all given measurements. Reuses the allocated memory.
+   * @param[in] measurement_vec Time-of-Flight measurements to be merged
+   * @param[in] timestamp_ns time of the point cloud in nanoseconds
+   */
+  void assign(const std::vector<TofMeasurement>& measurement_vec, std::uint64_t timestamp_ns);
+};
+
+} // namespace measurement
+
+} // namespace eduart
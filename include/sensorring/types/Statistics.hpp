@@ -0,0 +1,169 @@
+// Copyright (c) 2025 EduArt Robotik GmbH
+
+/**
+ * @file   Statistics.hpp
+ * @author EduArt Robotik GmbH
+ * @brief  Runtime statistics of the measurement pipeline
+ * @date   2026-10-17
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sensorring/platform/SensorringExport.hpp"
+
+namespace eduart {
+
+namespace manager {
+
+/**
+ * @class  LatencyHistogram
+ * @brief  Histogram of durations with fixed, logarithmically spaced buckets. Bucket 0 counts durations below 1 ns and
+ *         bucket i counts durations from 2^(i-1) ns up to 2^i ns. The last bucket also counts all longer durations.
+ */
+struct SENSORRING_API LatencyHistogram {
+  /// Number of buckets, the last regular bucket ends at about 275 s
+  static constexpr std::size_t BUCKETS = 40;
+
+  /// Number of recorded durations per bucket
+  std::array<std::uint64_t, BUCKETS> buckets = {};
+
+  /// Number of recorded durations
+  std::uint64_t count = 0;
+
+  /// Sum of all recorded durations in ns
+  std::uint64_t sum_ns = 0;
+
+  /// Longest recorded duration in ns
+  std::uint64_t max_ns = 0;
+
+  /**
+   * @brief Exclusive upper bound of a bucket
+   * @param[in] idx bucket index
+   * @return upper bound in ns
+   */
+  static std::uint64_t bucketUpperBoundNs(std::size_t idx);
+
+  /**
+   * @brief Mean of all recorded durations
+   * @return mean in µs or 0 if nothing was recorded
+   */
+  double meanUs() const;
+
+  /**
+   * @brief Longest recorded duration
+   * @return duration in µs or 0 if nothing was recorded
+   */
+  double maxUs() const;
+
+  /**
+   * @brief Estimate a percentile from the bucket boundaries. The result is the upper bound of the bucket that contains
+   *        the percentile, limited to the longest recorded duration.
+   * @param[in] percentile percentile in the range 0 ... 100
+   * @return duration in µs or 0 if nothing was recorded
+   */
+  double percentileUs(double percentile) const;
+};
+
+/**
+ * @class  StateStatistics
+ * @brief  Time spent in one state of the measurement state machine or in one step of a bus pipeline
+ */
+struct SENSORRING_API StateStatistics {
+  /// Name of the state
+  std::string name;
+
+  /// Name of the interface whose bus pipeline ran the state, empty for the states of the measurement state machine
+  std::string interface_name;
+
+  /// Duration of one execution of the state
+  LatencyHistogram duration;
+};
+
+/**
+ * @class  SensorStatistics
+ * @brief  Counters and decode times of the sensors of one sensor board
+ */
+struct SENSORRING_API SensorStatistics {
+  /// Name of the interface the sensor board is connected to
+  std::string interface_name;
+
+  /// Index of the sensor board on the interface
+  std::size_t idx = 0;
+
+  /// Number of decoded Time-of-Flight measurements
+  std::uint64_t tof_frames = 0;
+
+  /// Number of Time-of-Flight measurements that were discarded due to receive errors
+  std::uint64_t tof_receive_errors = 0;
+
+  /// Time to decode one Time-of-Flight measurement
+  LatencyHistogram tof_decode;
+
+  /// Number of decoded thermal measurements
+  std::uint64_t thermal_frames = 0;
+
+  /// Number of thermal measurements that were discarded due to receive errors
+  std::uint64_t thermal_receive_errors = 0;
+
+  /// Time to decode one thermal measurement
+  LatencyHistogram thermal_decode;
+};
+
+/**
+ * @class  ClientStatistics
+ * @brief  Time spent in the callbacks of one registered client
+ */
+struct SENSORRING_API ClientStatistics {
+  /// Address of the client, only used to tell the clients apart
+  const void* client = nullptr;
+
+  /// Duration of one callback of the client
+  LatencyHistogram notify;
+};
+
+/**
+ * @class  Statistics
+ * @brief  Snapshot of the runtime statistics of the measurement pipeline. All values are accumulated since the
+ *         construction of the MeasurementManager.
+ */
+struct SENSORRING_API Statistics {
+  /// Duration of the states of the measurement state machine, followed by the steps of every bus pipeline if the buses are measured in parallel
+  std::vector<StateStatistics> states;
+
+  /// Time from requesting a Time-of-Flight measurement until all sensors reported it as ready
+  LatencyHistogram tof_request_to_ready;
+
+  /// Time from fetching Time-of-Flight measurements until all data was received
+  LatencyHistogram tof_fetch_to_complete;
+
+  /// Time from fetching thermal measurements until all data was received
+  LatencyHistogram thermal_fetch_to_complete;
+
+  /// Number of published Time-of-Flight ring measurements
+  std::uint64_t tof_frames_published = 0;
+
+  /// Number of published thermal ring measurements
+  std::uint64_t thermal_frames_published = 0;
+
+  /// Number of sensor measurements that were missing in published ring measurements. A measurement is missing if its sensor reported an error or, with parallel buses, if its bus did not deliver before the frame was released.
+  std::uint64_t frames_dropped = 0;
+
+  /// Number of timeouts while waiting for measurements or data transmissions
+  std::uint64_t timeouts = 0;
+
+  /// Statistics of every sensor board
+  std::vector<SensorStatistics> sensors;
+
+  /// Statistics of every client that received a measurement
+  std::vector<ClientStatistics> clients;
+};
+
+} // namespace manager
+
+} // namespace eduart
@@ -24,11 +24,19 @@ namespace measurement {
  */
 class SENSORRING_API GrayscaleImage : public GenericGrayscaleImage<std::uint8_t, THERMAL_RESOLUTION> {};
 
+#ifdef SENSORRING_THERMAL_SINGLE_PRECISION
+/// Floating point type of the thermal processing, selected with the CMake option SENSORRING_THERMAL_SINGLE_PRECISION
+using TemperatureScalar = float;
+#else
+/// Floating point type of the thermal processing, selected with the CMake option SENSORRING_THERMAL_SINGLE_PRECISION
+using TemperatureScalar = double;
+#endif
+
 /**
  * @class  TemperatureImage
  * @brief  Pseudo image structure for the converted temperatures of a thermal image
  */
-class SENSORRING_API TemperatureImage : public GenericGrayscaleImage<double, THERMAL_RESOLUTION> {};
+class SENSORRING_API TemperatureImage : public GenericGrayscaleImage<TemperatureScalar, THERMAL_RESOLUTION> {};
 
 /**
  * @class  FalseColorImage
@@ -47,6 +55,12 @@ struct SENSORRING_API ThermalMeasurement {
   /// User assigned index of the sensor that measured the point
   unsigned int user_idx  = 0;
 
+  /// Receive time of the first CAN frame of the measurement in nanoseconds since the epoch (system clock)
+  std::uint64_t first_rx_timestamp_ns = 0;
+
+  /// Receive time of the last CAN frame of the measurement in nanoseconds since the epoch (system clock)
+  std::uint64_t last_rx_timestamp_ns = 0;
+
   /// Ambient temperature in °C
   double t_ambient_deg_c = 0;
 
@@ -59,10 +73,10 @@ struct SENSORRING_API ThermalMeasurement {
   /// Image structure where each pixel represents the temperature measured at that point in °C
   TemperatureImage temp_data_deg_c;
 
-  /// Grayscale image visualizing the thermal measurement
+  /// Grayscale image visualizing the thermal measurement. Stays empty if disabled in the ThermalSensorParams.
   GrayscaleImage grayscale_img;
 
-  /// False color image visualizing the thermal measurement
+  /// False color image visualizing the thermal measurement. Stays empty if disabled in the ThermalSensorParams.
   FalseColorImage falsecolor_img;
 };
 
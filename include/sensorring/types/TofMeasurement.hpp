@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "sensorring/math/Math.hpp"
 #include "sensorring/platform/SensorringExport.hpp"
 #include "sensorring/types/PointCloud.hpp"
@@ -25,6 +27,12 @@ struct SENSORRING_API TofMeasurement {
   /// Frame number of the ThermalMeasurement
   unsigned int frame_id = 0;
 
+  /// Receive time of the first CAN frame of the measurement in nanoseconds since the epoch (system clock)
+  std::uint64_t first_rx_timestamp_ns = 0;
+
+  /// Receive time of the last CAN frame of the measurement in nanoseconds since the epoch (system clock)
+  std::uint64_t last_rx_timestamp_ns = 0;
+
   /// Point cloud of the Time-of-Flight sensor measurement
   PointCloud point_cloud;
 };
@@ -0,0 +1,451 @@
+#include "BusPipeline.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "sensorring/logger/Logger.hpp"
+#include "utils/Profiling.hpp"
+
+namespace eduart {
+
+namespace manager {
+
+/* =======================================================================================
+        MeasurementAggregator
+==========================================================================================
+*/
+
+MeasurementAggregator::MeasurementAggregator(std::size_t bus_count, std::chrono::milliseconds timeout)
+    : _timeout(timeout)
+    , _slots(bus_count)
+    , _tof_count(0)
+    , _thermal_count(0)
+    , _tof_first_arrival(std::chrono::steady_clock::now())
+    , _thermal_first_arrival(std::chrono::steady_clock::now())
+    , _interrupted(false) {
+}
+
+void MeasurementAggregator::setSensorCount(std::size_t bus_idx, std::size_t tof_sensors, std::size_t thermal_sensors) {
+  LockGuard lock(_mutex);
+  auto& slot           = _slots.at(bus_idx);
+  slot.tof_sensors     = tof_sensors;
+  slot.thermal_sensors = thermal_sensors;
+}
+
+void MeasurementAggregator::publishTofData(std::size_t bus_idx, std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec, int error_frames) {
+  {
+    LockGuard lock(_mutex);
+    auto& slot = _slots.at(bus_idx);
+
+    if (!slot.tof_ready) {
+      if (_tof_count == 0)
+        _tof_first_arrival = std::chrono::steady_clock::now();
+      _tof_count++;
+    }
+
+    slot.tof_ready        = true;
+    slot.tof_error_frames = error_frames;
+    slot.raw_tof_vec.swap(raw_measurement_vec);
+    slot.transformed_tof_vec.swap(transformed_measurement_vec);
+  }
+  _cv.notify_all();
+}
+
+void MeasurementAggregator::publishThermalData(std::size_t bus_idx, std::vector<measurement::ThermalMeasurement>& measurement_vec, int error_frames) {
+  {
+    LockGuard lock(_mutex);
+    auto& slot = _slots.at(bus_idx);
+
+    if (!slot.thermal_ready) {
+      if (_thermal_count == 0)
+        _thermal_first_arrival = std::chrono::steady_clock::now();
+      _thermal_count++;
+    }
+
+    slot.thermal_ready        = true;
+    slot.thermal_error_frames = error_frames;
+    slot.thermal_vec.swap(measurement_vec);
+  }
+  _cv.notify_all();
+}
+
+bool MeasurementAggregator::isDue(std::size_t count, TimePoint first_arrival) const {
+  if (count == 0)
+    return false;
+  return (count >= _slots.size()) || ((std::chrono::steady_clock::now() - first_arrival) >= _timeout);
+}
+
+void MeasurementAggregator::waitForData(std::chrono::milliseconds max_wait) {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // wake up early when an incomplete frame times out
+  auto deadline = std::chrono::steady_clock::now() + max_wait;
+  if (_tof_count > 0)
+    deadline = std::min(deadline, _tof_first_arrival + _timeout);
+  if (_thermal_count > 0)
+    deadline = std::min(deadline, _thermal_first_arrival + _timeout);
+
+  _cv.wait_until(lock, deadline, [this]() {
+    return _interrupted || isDue(_tof_count, _tof_first_arrival) || isDue(_thermal_count, _thermal_first_arrival);
+  });
+  _interrupted = false;
+}
+
+bool MeasurementAggregator::takeTofFrame(std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec, int& error_frames, std::size_t& missing_buses, std::size_t& missing_sensors) {
+  LockGuard lock(_mutex);
+  if (!isDue(_tof_count, _tof_first_arrival))
+    return false;
+
+  raw_measurement_vec.clear();
+  transformed_measurement_vec.clear();
+  error_frames    = 0;
+  missing_buses   = _slots.size() - _tof_count;
+  missing_sensors = 0;
+
+  // keep the order of the buses in the ring
+  for (auto& slot : _slots) {
+    if (slot.tof_ready) {
+      raw_measurement_vec.insert(raw_measurement_vec.end(), std::make_move_iterator(slot.raw_tof_vec.begin()), std::make_move_iterator(slot.raw_tof_vec.end()));
+      transformed_measurement_vec.insert(transformed_measurement_vec.end(), std::make_move_iterator(slot.transformed_tof_vec.begin()), std::make_move_iterator(slot.transformed_tof_vec.end()));
+      error_frames += slot.tof_error_frames;
+      slot.tof_ready = false;
+    } else {
+      missing_sensors += slot.tof_sensors;
+    }
+  }
+  _tof_count = 0;
+
+  return true;
+}
+
+bool MeasurementAggregator::takeThermalFrame(std::vector<measurement::ThermalMeasurement>& measurement_vec, int& error_frames, std::size_t& missing_buses, std::size_t& missing_sensors) {
+  LockGuard lock(_mutex);
+  if (!isDue(_thermal_count, _thermal_first_arrival))
+    return false;
+
+  measurement_vec.clear();
+  error_frames    = 0;
+  missing_buses   = _slots.size() - _thermal_count;
+  missing_sensors = 0;
+
+  // keep the order of the buses in the ring
+  for (auto& slot : _slots) {
+    if (slot.thermal_ready) {
+      measurement_vec.insert(measurement_vec.end(), std::make_move_iterator(slot.thermal_vec.begin()), std::make_move_iterator(slot.thermal_vec.end()));
+      error_frames += slot.thermal_error_frames;
+      slot.thermal_ready = false;
+    } else {
+      missing_sensors += slot.thermal_sensors;
+    }
+  }
+  _thermal_count = 0;
+
+  return true;
+}
+
+void MeasurementAggregator::reset() {
+  LockGuard lock(_mutex);
+  for (auto& slot : _slots) {
+    slot.tof_ready     = false;
+    slot.thermal_ready = false;
+  }
+  _tof_count     = 0;
+  _thermal_count = 0;
+  _interrupted   = false;
+}
+
+void MeasurementAggregator::interrupt() {
+  {
+    LockGuard lock(_mutex);
+    _interrupted = true;
+  }
+  _cv.notify_all();
+}
+
+/* =======================================================================================
+        BusPipeline
+==========================================================================================
+*/
+
+BusPipeline::BusPipeline(std::size_t bus_idx, ring::SensorRing* sensor_ring, MeasurementAggregator* aggregator, PipelineParams params, const std::atomic<bool>& tof_enabled, const std::atomic<bool>& thermal_enabled, PipelineStatistics* statistics)
+    : _bus_idx(bus_idx)
+    , _sensor_ring(sensor_ring)
+    , _sensor_bus(sensor_ring->getInterfaces().at(bus_idx))
+    , _aggregator(aggregator)
+    , _params(params)
+    , _tof_enabled(tof_enabled)
+    , _thermal_enabled(thermal_enabled)
+    , _statistics(statistics)
+    , _first_measurement(true)
+    , _thermal_measurement_flag(false)
+    , _last_tof_measurement_timestamp(std::chrono::steady_clock::now())
+    , _last_thermal_measurement_timestamp(std::chrono::steady_clock::now())
+    , _light_mode(light::LightMode::Off)
+    , _light_color{ 0, 0, 0 }
+    , _light_update_flag(false)
+    , _state(PipelineState::Stopped)
+    , _is_running(false) {
+}
+
+BusPipeline::~BusPipeline() {
+  stop();
+}
+
+bool BusPipeline::start() {
+  if (_is_running || _thread.joinable())
+    return false;
+
+  _first_measurement                  = true;
+  _thermal_measurement_flag           = false;
+  _last_tof_measurement_timestamp     = std::chrono::steady_clock::now();
+  _last_thermal_measurement_timestamp = std::chrono::steady_clock::now();
+
+  _state      = PipelineState::Running;
+  _is_running = true;
+  _thread     = std::thread(&BusPipeline::run, this);
+  return true;
+}
+
+void BusPipeline::stop() {
+  _is_running = false;
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+
+  if (_state == PipelineState::Running || _state == PipelineState::Recovering)
+    _state = PipelineState::Stopped;
+}
+
+PipelineState BusPipeline::getState() const {
+  return _state;
+}
+
+void BusPipeline::setLight(light::LightMode mode, std::uint8_t red, std::uint8_t green, std::uint8_t blue) {
+  std::lock_guard<std::mutex> lock(_light_mutex);
+  _light_mode        = mode;
+  _light_color[0]    = red;
+  _light_color[1]    = green;
+  _light_color[2]    = blue;
+  _light_update_flag = true;
+}
+
+void BusPipeline::appendStateStatistics(std::vector<StateStatistics>& states) const {
+  const auto& interface_name = _sensor_bus->getInterface()->getInterfaceName();
+  states.push_back({ "wait_for_data", interface_name, _wait_for_data_latency.snapshot() });
+  states.push_back({ "fetch_tof_data", interface_name, _fetch_tof_latency.snapshot() });
+  states.push_back({ "fetch_thermal_data", interface_name, _fetch_thermal_latency.snapshot() });
+  states.push_back({ "throttle_measurement", interface_name, _throttle_latency.snapshot() });
+}
+
+void BusPipeline::run() noexcept {
+  PROFILE_THREAD(("sensorring pipeline " + _sensor_bus->getInterface()->getInterfaceName()).c_str());
+
+  while (_is_running) {
+    try {
+      if (!cycle()) {
+        if (!repairMeasurement()) {
+          _state = PipelineState::MeasurementFailed;
+          break;
+        }
+      }
+    } catch (const std::exception& e) {
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Caught exception in measurement pipeline of interface " + _sensor_bus->getInterface()->getInterfaceName() + ": " + std::string(e.what()));
+      if (!repairCommunication()) {
+        _state = PipelineState::CommunicationFailed;
+        break;
+      }
+    }
+  }
+}
+
+bool BusPipeline::cycle() {
+  PROFILE_ZONE("BusPipeline::cycle");
+  const auto& interface_name = _sensor_bus->getInterface()->getInterfaceName();
+  const bool tof_enabled     = _tof_enabled;
+  const bool thermal_enabled = _thermal_enabled;
+
+  // set lights
+  if (_light_update_flag.exchange(false)) {
+    std::lock_guard<std::mutex> lock(_light_mutex);
+    _sensor_ring->setLight(_bus_idx, _light_mode, _light_color[0], _light_color[1], _light_color[2]);
+  }
+
+  // request tof measurement
+  if (tof_enabled)
+    _sensor_ring->requestTofMeasurement(_bus_idx);
+  _last_tof_measurement_timestamp = std::chrono::steady_clock::now();
+
+  // request thermal measurement
+  if (thermal_enabled && !_thermal_measurement_flag) {
+    bool measure_thermal = true;
+    if (_params.is_thermal_throttled) {
+      if ((std::chrono::steady_clock::now() - _last_thermal_measurement_timestamp) < _params.thermal_measurement_period) {
+        measure_thermal = false;
+      }
+    }
+
+    if (measure_thermal) {
+      _sensor_ring->requestThermalMeasurement(_bus_idx);
+      _last_thermal_measurement_timestamp = std::chrono::steady_clock::now();
+      _thermal_measurement_flag           = true;
+    }
+  }
+
+  // wait for the completion of measurements if a frequency was specified or this is the first measurement. In pipelined
+  // mode the previous measurement is fetched while the sensors integrate the one that was just requested.
+  if ((_params.is_tof_throttled && !_params.pipeline_tof_measurements) || _first_measurement) {
+    PROFILE_ZONE("wait_for_data");
+    utils::ScopedLatency latency(_wait_for_data_latency);
+    if (tof_enabled) {
+      if (!_sensor_ring->waitForAllTofMeasurementsReady(_bus_idx)) {
+        _statistics->timeouts.fetch_add(1, std::memory_order_relaxed);
+        logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while waiting for completion of measurements on interface " + interface_name + ".");
+        return false;
+      }
+      _statistics->tof_request_to_ready.recordSince(_last_tof_measurement_timestamp);
+    }
+  }
+
+  if (_first_measurement) {
+    _first_measurement = false;
+    return true;
+  }
+
+  // fetch a tof measurement and hand it over to the aggregator
+  if (tof_enabled) {
+    PROFILE_ZONE("fetch_tof_data");
+    utils::ScopedLatency latency(_fetch_tof_latency);
+    const auto fetch_start = std::chrono::steady_clock::now();
+    _sensor_ring->fetchTofMeasurement(_bus_idx);
+    if (!_sensor_ring->waitForAllTofDataTransmissionsComplete(_bus_idx)) {
+      _statistics->timeouts.fetch_add(1, std::memory_order_relaxed);
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while fetching tof measurements on interface " + interface_name + ".");
+      return false;
+    }
+    _statistics->tof_fetch_to_complete.recordSince(fetch_start);
+
+    _raw_tof_vec.clear();
+    _transformed_tof_vec.clear();
+    int error_frames = _sensor_bus->getLatestTofMeasurements(_raw_tof_vec, _transformed_tof_vec);
+    _aggregator->publishTofData(_bus_idx, _raw_tof_vec, _transformed_tof_vec, error_frames);
+  }
+
+  // fetch a thermal measurement and hand it over to the aggregator
+  if (thermal_enabled && _thermal_measurement_flag) {
+    PROFILE_ZONE("fetch_thermal_data");
+    utils::ScopedLatency latency(_fetch_thermal_latency);
+    const auto fetch_start = std::chrono::steady_clock::now();
+    _sensor_ring->fetchThermalMeasurement(_bus_idx);
+    _thermal_measurement_flag = false;
+    if (!_sensor_ring->waitForAllThermalDataTransmissionsComplete(_bus_idx)) {
+      _statistics->timeouts.fetch_add(1, std::memory_order_relaxed);
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while fetching thermal measurements on interface " + interface_name + ".");
+      return false;
+    }
+    _statistics->thermal_fetch_to_complete.recordSince(fetch_start);
+
+    _thermal_vec.clear();
+    int error_frames = _sensor_bus->getLatestThermalMeasurements(_thermal_vec);
+    _aggregator->publishThermalData(_bus_idx, _thermal_vec, error_frames);
+  }
+
+  // throttled mode: wait until next measurement period
+  {
+    PROFILE_ZONE("throttle_measurement");
+    utils::ScopedLatency latency(_throttle_latency);
+    if (tof_enabled && _params.is_tof_throttled) {
+      std::this_thread::sleep_until(_last_tof_measurement_timestamp + _params.tof_measurement_period);
+    }
+
+    if (!_sensor_ring->waitForAllTofMeasurementsReady(_bus_idx)) {
+      _statistics->timeouts.fetch_add(1, std::memory_order_relaxed);
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while taking tof measurements on interface " + interface_name + ".");
+      return false;
+    }
+    if (tof_enabled) {
+      _statistics->tof_request_to_ready.recordSince(_last_tof_measurement_timestamp);
+    }
+  }
+
+  return true;
+}
+
+bool BusPipeline::repairMeasurement() {
+  const auto& interface_name = _sensor_bus->getInterface()->getInterfaceName();
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Error handler for measurement errors called on interface " + interface_name + ".");
+  _state = PipelineState::Recovering;
+
+  if (!_params.repair_errors) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Will not attempt to restart measurements because parameter \"repair_errors\" is set to \"false\".");
+    return false;
+  }
+
+  // Try to fix the error
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Trying to restart measurements on interface " + interface_name + ".");
+
+  bool success          = false;
+  unsigned int attempts = 0;
+  _sensor_ring->resetSensorState(_bus_idx);
+  do {
+    attempts++;
+    _sensor_ring->requestTofMeasurement(_bus_idx);
+    success = _sensor_ring->waitForAllTofMeasurementsReady(_bus_idx);
+  } while (!success && _is_running && (attempts < 10));
+
+  if (success) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Restarting measurements on interface " + interface_name + " succeeded after " + std::to_string(attempts) + " attempts.");
+    _thermal_measurement_flag = false;
+    _light_update_flag        = true;
+    _state                    = PipelineState::Running;
+  } else if (_is_running) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Failed to restart measurements on interface " + interface_name + ".");
+  }
+
+  return success || !_is_running;
+}
+
+bool BusPipeline::repairCommunication() {
+  auto interface = _sensor_bus->getInterface();
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Error handler for communication errors called on interface " + interface->getInterfaceName() + ".");
+  _state = PipelineState::Recovering;
+
+  if (!_params.repair_errors) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Will not attempt to restart measurements because parameter \"repair_errors\" is set to \"false\".");
+    return false;
+  }
+
+  // Try to fix the error
+  bool success          = true;
+  unsigned int attempts = 0;
+  if (interface->hasError()) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Communication error detected. Trying to restart interface " + interface->getInterfaceName() + ".");
+
+    do {
+      attempts++;
+      try {
+        success = interface->repairInterface();
+      } catch (std::runtime_error&) {
+        success = false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    } while (!success && _is_running && (attempts < 40));
+  }
+
+  if (success) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Restarting communication on interface " + interface->getInterfaceName() + " succeeded after " + std::to_string(attempts) + " attempts.");
+    _thermal_measurement_flag = false;
+    _light_update_flag        = true;
+    _state                    = PipelineState::Running;
+  } else if (_is_running) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Failed to restart communication on interface " + interface->getInterfaceName() + ". Please check the interface.");
+  }
+
+  return success || !_is_running;
+}
+
+} // namespace manager
+
+} // namespace eduart
\ No newline at end of file
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sensorring/types/ThermalMeasurement.hpp"
+#include "sensorring/types/TofMeasurement.hpp"
+#include "utils/LatencyRecorder.hpp"
+
+#include "SensorRing.hpp"
+
+namespace eduart {
+
+namespace manager {
+
+/**
+ * @class MeasurementAggregator
+ * @brief Combines the measurements that the bus pipelines deliver independently into synchronized ring frames. A frame
+ * is complete when every bus delivered its part. If a bus does not deliver in time the frame is released with the
+ * measurements of the remaining buses.
+ */
+class MeasurementAggregator {
+public:
+  /**
+   * Constructor
+   * @param[in] bus_count number of buses that contribute to a frame
+   * @param[in] timeout maximum age of an incomplete frame before it is released
+   */
+  MeasurementAggregator(std::size_t bus_count, std::chrono::milliseconds timeout);
+
+  /**
+   * Set the number of enabled sensors of a bus. The sensors of a bus that did not contribute to a released frame are
+   * counted as missing.
+   * @param[in] bus_idx index of the bus
+   * @param[in] tof_sensors number of enabled Time-of-Flight sensors
+   * @param[in] thermal_sensors number of enabled thermal sensors
+   */
+  void setSensorCount(std::size_t bus_idx, std::size_t tof_sensors, std::size_t thermal_sensors);
+
+  /**
+   * Hand over the latest Time-of-Flight measurements of a bus. Replaces earlier measurements of the same bus that were
+   * not released yet. The vectors are swapped with the buffers of the bus and hold outdated measurements afterwards,
+   * so the measurements are not copied and the allocations are reused in the next cycle.
+   * @param[in] bus_idx index of the bus
+   * @param[in,out] raw_measurement_vec raw measurements of all sensors on the bus
+   * @param[in,out] transformed_measurement_vec transformed measurements of all sensors on the bus
+   * @param[in] error_frames number of sensors on the bus that failed to deliver a valid measurement
+   */
+  void publishTofData(std::size_t bus_idx, std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec, int error_frames);
+
+  /**
+   * Hand over the latest thermal measurements of a bus. Replaces earlier measurements of the same bus that were not
+   * released yet. The vector is swapped with the buffer of the bus and holds outdated measurements afterwards.
+   * @param[in] bus_idx index of the bus
+   * @param[in,out] measurement_vec measurements of all sensors on the bus
+   * @param[in] error_frames number of sensors on the bus that failed to deliver a valid measurement
+   */
+  void publishThermalData(std::size_t bus_idx, std::vector<measurement::ThermalMeasurement>& measurement_vec, int error_frames);
+
+  /**
+   * Block until a frame can be released, the wait is interrupted or the maximum waiting time has passed
+   * @param[in] max_wait maximum waiting time
+   */
+  void waitForData(std::chrono::milliseconds max_wait);
+
+  /**
+   * Release the Time-of-Flight frame if it is complete or timed out. The measurements are moved out of the buffers of
+   * the buses.
+   * @param[out] raw_measurement_vec raw measurements of all buses
+   * @param[out] transformed_measurement_vec transformed measurements of all buses
+   * @param[out] error_frames number of sensors that failed to deliver a valid measurement
+   * @param[out] missing_buses number of buses that did not contribute to the frame
+   * @param[out] missing_sensors number of sensors on the buses that did not contribute to the frame
+   * @return true if a frame was released
+   */
+  bool takeTofFrame(std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec, int& error_frames, std::size_t& missing_buses, std::size_t& missing_sensors);
+
+  /**
+   * Release the thermal frame if it is complete or timed out. The measurements are moved out of the buffers of the buses.
+   * @param[out] measurement_vec measurements of all buses
+   * @param[out] error_frames number of sensors that failed to deliver a valid measurement
+   * @param[out] missing_buses number of buses that did not contribute to the frame
+   * @param[out] missing_sensors number of sensors on the buses that did not contribute to the frame
+   * @return true if a frame was released
+   */
+  bool takeThermalFrame(std::vector<measurement::ThermalMeasurement>& measurement_vec, int& error_frames, std::size_t& missing_buses, std::size_t& missing_sensors);
+
+  /**
+   * Discard all pending measurements
+   */
+  void reset();
+
+  /**
+   * Wake up a thread that is waiting for data
+   */
+  void interrupt();
+
+private:
+  struct BusSlot {
+    std::size_t tof_sensors     = 0;
+    std::size_t thermal_sensors = 0;
+
+    bool tof_ready       = false;
+    int tof_error_frames = 0;
+    std::vector<measurement::TofMeasurement> raw_tof_vec;
+    std::vector<measurement::TofMeasurement> transformed_tof_vec;
+
+    bool thermal_ready       = false;
+    int thermal_error_frames = 0;
+    std::vector<measurement::ThermalMeasurement> thermal_vec;
+  };
+
+  using LockGuard = std::lock_guard<std::mutex>;
+  using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+  bool isDue(std::size_t count, TimePoint first_arrival) const;
+
+  const std::chrono::milliseconds _timeout;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::vector<BusSlot> _slots;
+
+  std::size_t _tof_count;
+  std::size_t _thermal_count;
+  TimePoint _tof_first_arrival;
+  TimePoint _thermal_first_arrival;
+  bool _interrupted;
+};
+
+/**
+ * @enum PipelineState
+ * @brief Health status of a bus pipeline
+ */
+enum class PipelineState {
+  Stopped,
+  Running,
+  Recovering,
+  MeasurementFailed,
+  CommunicationFailed
+};
+
+/**
+ * @struct PipelineParams
+ * @brief Timing and error handling parameters of a bus pipeline
+ */
+struct PipelineParams {
+  bool repair_errors                                       = true;
+  bool is_tof_throttled                                    = false;
+  bool is_thermal_throttled                                = false;
+  bool pipeline_tof_measurements                           = false;
+  std::chrono::duration<double> tof_measurement_period     = std::chrono::duration<double>(0.0);
+  std::chrono::duration<double> thermal_measurement_period = std::chrono::duration<double>(0.0);
+};
+
+/**
+ * @struct PipelineStatistics
+ * @brief Lock-free timing and error counters that the state machine and all bus pipelines record into
+ */
+struct PipelineStatistics {
+  utils::LatencyRecorder tof_request_to_ready;
+  utils::LatencyRecorder tof_fetch_to_complete;
+  utils::LatencyRecorder thermal_fetch_to_complete;
+  std::atomic<std::uint64_t> tof_frames_published{ 0 };
+  std::atomic<std::uint64_t> thermal_frames_published{ 0 };
+  std::atomic<std::uint64_t> frames_dropped{ 0 };
+  std::atomic<std::uint64_t> timeouts{ 0 };
+};
+
+/**
+ * @class BusPipeline
+ * @brief Measurement loop for a single bus of the sensor ring. Each pipeline runs in its own thread with independent
+ * request, fetch and error recovery and hands the measurements over to the MeasurementAggregator.
+ */
+class BusPipeline {
+public:
+  /**
+   * Constructor
+   * @param[in] bus_idx index of the bus within the sensor ring
+   * @param[in] sensor_ring sensor ring that contains the bus
+   * @param[in] aggregator aggregator that receives the measurements
+   * @param[in] params timing and error handling parameters
+   * @param[in] tof_enabled enable signal of the Time-of-Flight measurements
+   * @param[in] thermal_enabled enable signal of the thermal measurements
+   * @param[in] statistics statistics that the pipeline records into
+   */
+  BusPipeline(std::size_t bus_idx, ring::SensorRing* sensor_ring, MeasurementAggregator* aggregator, PipelineParams params, const std::atomic<bool>& tof_enabled, const std::atomic<bool>& thermal_enabled, PipelineStatistics* statistics);
+
+  /**
+   * Destructor
+   */
+  ~BusPipeline();
+
+  /**
+   * Start the pipeline thread
+   * @return false if the pipeline is already running
+   */
+  bool start();
+
+  /**
+   * Stop the pipeline thread and wait for it to finish
+   */
+  void stop();
+
+  /**
+   * Get the health status of the pipeline
+   * @return current pipeline state
+   */
+  PipelineState getState() const;
+
+  /**
+   * Set the light mode and color of the sensor boards on the bus. Applied at the beginning of the next cycle.
+   * @param[in] mode Light mode to set
+   * @param[in] red Red color value
+   * @param[in] green Green color value
+   * @param[in] blue Blue color value
+   */
+  void setLight(light::LightMode mode, std::uint8_t red, std::uint8_t green, std::uint8_t blue);
+
+  /**
+   * Append the durations of the steps of the pipeline to the state statistics
+   * @param[in,out] states state statistics that the steps are appended to
+   */
+  void appendStateStatistics(std::vector<StateStatistics>& states) const;
+
+private:
+  void run() noexcept;
+  bool cycle();
+  bool repairMeasurement();
+  bool repairCommunication();
+
+  const std::size_t _bus_idx;
+  ring::SensorRing* _sensor_ring;
+  const bus::SensorBus* _sensor_bus;
+  MeasurementAggregator* _aggregator;
+  const PipelineParams _params;
+  const std::atomic<bool>& _tof_enabled;
+  const std::atomic<bool>& _thermal_enabled;
+  PipelineStatistics* _statistics;
+
+  bool _first_measurement;
+  bool _thermal_measurement_flag;
+  std::chrono::time_point<std::chrono::steady_clock> _last_tof_measurement_timestamp;
+  std::chrono::time_point<std::chrono::steady_clock> _last_thermal_measurement_timestamp;
+
+  std::vector<measurement::TofMeasurement> _raw_tof_vec;
+  std::vector<measurement::TofMeasurement> _transformed_tof_vec;
+  std::vector<measurement::ThermalMeasurement> _thermal_vec;
+
+  // Durations of the steps of a cycle, named like the corresponding states of the state machine
+  utils::LatencyRecorder _wait_for_data_latency;
+  utils::LatencyRecorder _fetch_tof_latency;
+  utils::LatencyRecorder _fetch_thermal_latency;
+  utils::LatencyRecorder _throttle_latency;
+
+  std::mutex _light_mutex;
+  light::LightMode _light_mode;
+  std::uint8_t _light_color[3];
+  std::atomic<bool> _light_update_flag;
+
+  std::atomic<PipelineState> _state;
+  std::atomic<bool> _is_running;
+  std::thread _thread;
+};
+
+} // namespace manager
+
+} // namespace eduart
@@ -43,6 +43,14 @@ void MeasurementManager::setLight(light::LightMode mode, std::uint8_t red, std::
   return _mm_impl->setLight(mode, red, green, blue);
 }
 
+void MeasurementManager::pushEgoMotion(const measurement::EgoMotion& motion) noexcept {
+  _mm_impl->pushEgoMotion(motion);
+}
+
+Statistics MeasurementManager::getStatistics() const {
+  return _mm_impl->getStatistics();
+}
+
 /* =======================================================================================
         Handle observers
 ==========================================================================================
@@ -52,6 +60,10 @@ void MeasurementManager::registerClient(MeasurementClient* observer) noexcept {
   return _mm_impl->registerClient(observer);
 }
 
+void MeasurementManager::registerClient(MeasurementClient* observer, bool ring_point_cloud) noexcept {
+  return _mm_impl->registerClient(observer, ring_point_cloud);
+}
+
 void MeasurementManager::unregisterClient(MeasurementClient* observer) noexcept {
   return _mm_impl->unregisterClient(observer);
 }
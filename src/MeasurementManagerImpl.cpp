@@ -8,7 +8,10 @@
 #include "interface/ComManager.hpp"
 #include "sensorring/MeasurementClient.hpp"
 #include "sensorring/Parameter.hpp"
+#include "logger/LogMacros.hpp"
 #include "sensorring/logger/Logger.hpp"
+#include "utils/Clock.hpp"
+#include "utils/Profiling.hpp"
 
 #include "SensorBoard.hpp"
 #include "SensorBus.hpp"
@@ -41,7 +44,20 @@ MeasurementManagerImpl::MeasurementManagerImpl(ManagerParams params)
   // Assemble the sensor ring
   std::vector<std::unique_ptr<bus::SensorBus> > bus_vec;
   for (const auto& bus_params : params.ring_params.bus_param_vec) {
-    auto interface = com::ComManager::getInstance()->createInterface(bus_params.interface_name, bus_params.type);
+    // a simulated bus emulates the configured boards unless a different number is requested
+    auto interface_params = bus_params;
+    if (interface_params.simulation.board_count == 0) {
+      interface_params.simulation.board_count = static_cast<unsigned int>(bus_params.board_param_vec.size());
+    }
+
+    auto interface = com::ComManager::getInstance()->createInterface(interface_params);
+    if (interface) {
+      interface->setTxFrameGap(std::chrono::microseconds(bus_params.tx_frame_gap_us));
+
+      if (!bus_params.record_file.empty() && !interface->startRecording(bus_params.record_file)) {
+        logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Unable to record interface " + bus_params.interface_name + " to file " + bus_params.record_file);
+      }
+    }
 
     unsigned int idx = 0;
     std::vector<std::unique_ptr<sensor::SensorBoard> > board_vec;
@@ -61,8 +77,50 @@ MeasurementManagerImpl::MeasurementManagerImpl(ManagerParams params)
   // check if there are active tof or thermal sensors
   for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
     for (unsigned int j = 0; j < sensor_bus->getSensorCount(); j++) {
-      _tof_enabled |= sensor_bus->isTofEnabled(j);
-      _thermal_enabled |= sensor_bus->isThermalEnabled(j);
+      _tof_enabled     = _tof_enabled || sensor_bus->isTofEnabled(j);
+      _thermal_enabled = _thermal_enabled || sensor_bus->isThermalEnabled(j);
+    }
+  }
+
+  // requests faster than the sensors can measure would only wait for the sensors, so the rate is limited to the
+  // maximum rate of the slowest enabled sensor. Without a target frequency the sensors pace the requests themselves.
+  double tof_max_rate = 0.0;
+  for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
+    for (const auto* board : sensor_bus->getSensorBoards()) {
+      if (board->getTof()->getEnable() && (tof_max_rate == 0.0 || board->getTof()->getMaxRate() < tof_max_rate)) {
+        tof_max_rate = board->getTof()->getMaxRate();
+      }
+    }
+  }
+  if (_is_tof_throttled && tof_max_rate > 0.0 && params.frequency_tof_hz > tof_max_rate) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "The ToF measurement frequency of " + std::to_string(params.frequency_tof_hz) + " Hz exceeds the maximum rate of the sensors, requesting at " + std::to_string(tof_max_rate) + " Hz");
+    _tof_measurement_period = std::chrono::duration<double>(1.0 / tof_max_rate);
+  }
+
+  // prepare one measurement pipeline per bus
+  if (_params.parallel_buses && _sensor_ring->getBusCount() > 1) {
+    PipelineParams pipeline_params;
+    pipeline_params.repair_errors              = _params.repair_errors;
+    pipeline_params.is_tof_throttled           = _is_tof_throttled;
+    pipeline_params.is_thermal_throttled       = _is_thermal_throttled;
+    pipeline_params.pipeline_tof_measurements  = _params.pipeline_tof_measurements;
+    pipeline_params.tof_measurement_period     = _tof_measurement_period;
+    pipeline_params.thermal_measurement_period = _thermal_measurement_period;
+
+    _aggregator = std::make_unique<MeasurementAggregator>(_sensor_ring->getBusCount(), _params.ring_params.timeout);
+    const auto bus_vec = _sensor_ring->getInterfaces();
+    for (std::size_t i = 0; i < bus_vec.size(); i++) {
+      const auto* sensor_bus      = bus_vec[i];
+      std::size_t tof_sensors     = 0;
+      std::size_t thermal_sensors = 0;
+      for (unsigned int j = 0; j < sensor_bus->getSensorCount(); j++) {
+        tof_sensors += sensor_bus->isTofEnabled(j) ? 1 : 0;
+        thermal_sensors += sensor_bus->isThermalEnabled(j) ? 1 : 0;
+      }
+      _aggregator->setSensorCount(i, tof_sensors, thermal_sensors);
+    }
+    for (std::size_t i = 0; i < _sensor_ring->getBusCount(); i++) {
+      _pipelines.push_back(std::make_unique<BusPipeline>(i, _sensor_ring.get(), _aggregator.get(), pipeline_params, _tof_enabled, _thermal_enabled, &_statistics));
     }
   }
 
@@ -72,6 +130,13 @@ MeasurementManagerImpl::MeasurementManagerImpl(ManagerParams params)
 
 MeasurementManagerImpl::~MeasurementManagerImpl() noexcept {
   stopMeasuring();
+
+  // the interfaces outlive the manager, so the recordings are closed here
+  for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
+    if (sensor_bus->getInterface()) {
+      sensor_bus->getInterface()->stopRecording();
+    }
+  }
 }
 
 void MeasurementManagerImpl::enableTofMeasurement(bool state) noexcept {
@@ -131,15 +196,109 @@ void MeasurementManagerImpl::setLight(light::LightMode mode, std::uint8_t red, s
   _light_update_flag = true;
 }
 
+void MeasurementManagerImpl::pushEgoMotion(const measurement::EgoMotion& motion) noexcept {
+  _motion_compensator.push(motion);
+}
+
+Statistics MeasurementManagerImpl::getStatistics() const {
+  Statistics statistics;
+
+  for (std::size_t i = 0; i < STATE_COUNT; i++) {
+    statistics.states.push_back({ getStateName(static_cast<MeasurementState>(i)), "", _state_latency[i].snapshot() });
+  }
+  for (const auto& pipeline : _pipelines) {
+    pipeline->appendStateStatistics(statistics.states);
+  }
+
+  statistics.tof_request_to_ready      = _statistics.tof_request_to_ready.snapshot();
+  statistics.tof_fetch_to_complete     = _statistics.tof_fetch_to_complete.snapshot();
+  statistics.thermal_fetch_to_complete = _statistics.thermal_fetch_to_complete.snapshot();
+  statistics.tof_frames_published      = _statistics.tof_frames_published.load(std::memory_order_relaxed);
+  statistics.thermal_frames_published  = _statistics.thermal_frames_published.load(std::memory_order_relaxed);
+  statistics.frames_dropped            = _statistics.frames_dropped.load(std::memory_order_relaxed);
+  statistics.timeouts                  = _statistics.timeouts.load(std::memory_order_relaxed);
+
+  for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
+    for (const auto& board : sensor_bus->getSensorBoards()) {
+      SensorStatistics sensor;
+      sensor.interface_name         = sensor_bus->getInterface()->getInterfaceName();
+      sensor.idx                    = board->getTof()->getIdx();
+      sensor.tof_frames             = board->getTof()->getFrameCount();
+      sensor.tof_receive_errors     = board->getTof()->getReceiveErrorCount();
+      sensor.tof_decode             = board->getTof()->getDecodeLatency();
+      sensor.thermal_frames         = board->getThermal()->getFrameCount();
+      sensor.thermal_receive_errors = board->getThermal()->getReceiveErrorCount();
+      sensor.thermal_decode         = board->getThermal()->getDecodeLatency();
+      statistics.sensors.push_back(sensor);
+    }
+  }
+
+  LockGuard lock(_client_mutex);
+  for (const auto& client : _client_latency) {
+    statistics.clients.push_back({ client.first, client.second.snapshot() });
+  }
+
+  return statistics;
+}
+
+const char* MeasurementManagerImpl::getStateName(MeasurementState state) {
+  switch (state) {
+  case MeasurementState::init:
+    return "init";
+  case MeasurementState::reset_sensors:
+    return "reset_sensors";
+  case MeasurementState::enumerate_sensors:
+    return "enumerate_sensors";
+  case MeasurementState::sync_lights:
+    return "sync_lights";
+  case MeasurementState::get_eeprom:
+    return "get_eeprom";
+  case MeasurementState::pre_loop_init:
+    return "pre_loop_init";
+  case MeasurementState::set_lights:
+    return "set_lights";
+  case MeasurementState::request_tof_measurement:
+    return "request_tof_measurement";
+  case MeasurementState::fetch_tof_data:
+    return "fetch_tof_data";
+  case MeasurementState::request_thermal_measurement:
+    return "request_thermal_measurement";
+  case MeasurementState::fetch_thermal_data:
+    return "fetch_thermal_data";
+  case MeasurementState::wait_for_data:
+    return "wait_for_data";
+  case MeasurementState::throttle_measurement:
+    return "throttle_measurement";
+  case MeasurementState::run_pipelines:
+    return "run_pipelines";
+  case MeasurementState::error_handler_measurement:
+    return "error_handler_measurement";
+  case MeasurementState::error_handler_communication:
+    return "error_handler_communication";
+  case MeasurementState::shutdown:
+    return "shutdown";
+  }
+  return "unknown";
+}
+
 /* =======================================================================================
         Handle clients
 ==========================================================================================
 */
 
 void MeasurementManagerImpl::registerClient(MeasurementClient* client) noexcept {
+  registerClient(client, false);
+}
+
+void MeasurementManagerImpl::registerClient(MeasurementClient* client, bool ring_point_cloud) noexcept {
   if (client) {
     LockGuard lock(_client_mutex);
     auto result = _clients.insert(client);
+    if (ring_point_cloud) {
+      _ring_point_cloud_clients.insert(client);
+    } else {
+      _ring_point_cloud_clients.erase(client);
+    }
 
     // Check if the client was registered
     if (result.second) {
@@ -156,6 +315,8 @@ void MeasurementManagerImpl::unregisterClient(MeasurementClient* client) noexcep
   if (client) {
     LockGuard lock(_client_mutex);
     auto result = _clients.erase(client);
+    _ring_point_cloud_clients.erase(client);
+    _client_latency.erase(client);
 
     // Check if the client was removed
     if (result > 0) {
@@ -173,71 +334,90 @@ int MeasurementManagerImpl::notifyToFData() {
   std::vector<measurement::TofMeasurement> raw_measurement_vec, transformed_measurement_vec;
 
   for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
-    for (const auto& sensor_board : sensor_bus->getSensorBoards()) {
-      if (sensor_board->getTof()->getEnable()) {
-        auto [raw_measurement, raw_error] = sensor_board->getTof()->getLatestRawMeasurement();
-        if (raw_error == sensor::SensorState::SensorOK) {
-          if (!raw_measurement.point_cloud.data.empty())
-            raw_measurement_vec.emplace_back(raw_measurement);
-        } else {
-          error_frames++;
-        }
+    error_frames += sensor_bus->getLatestTofMeasurements(raw_measurement_vec, transformed_measurement_vec);
+  }
 
-        auto [transformed_measurement, transformed_error] = sensor_board->getTof()->getLatestTransformedMeasurement();
-        if (transformed_error == sensor::SensorState::SensorOK) {
-          if (!transformed_measurement.point_cloud.data.empty())
-            transformed_measurement_vec.emplace_back(transformed_measurement);
-        }
-      }
-    }
+  publishToFData(raw_measurement_vec, transformed_measurement_vec);
+  return error_frames;
+}
+
+int MeasurementManagerImpl::notifyThermalData() {
+  int error_frames = 0;
+  std::vector<measurement::ThermalMeasurement> measurement_vec;
+
+  for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
+    error_frames += sensor_bus->getLatestThermalMeasurements(measurement_vec);
+  }
+
+  publishThermalData(measurement_vec);
+  return error_frames;
+}
+
+void MeasurementManagerImpl::publishToFData(const std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec) {
+  PROFILE_ZONE("publishToFData");
+  PROFILE_FRAME("tof");
+  PROFILE_PLOT_RATE("tof fps");
+  PROFILE_PLOT_CAN_FRAMES("can frames per cycle");
+
+  if (!raw_measurement_vec.empty() || !transformed_measurement_vec.empty()) {
+    _statistics.tof_frames_published.fetch_add(1, std::memory_order_relaxed);
   }
 
   if (!raw_measurement_vec.empty()) {
     LockGuard lock(_client_mutex);
     for (auto client : _clients) {
-      if (client)
+      if (client) {
+        utils::ScopedLatency latency(_client_latency[client]);
         client->onRawTofMeasurement(raw_measurement_vec);
+      }
     }
   }
 
   if (!transformed_measurement_vec.empty()) {
+    // align all sensors to a common time, the points are moved in place
+    std::uint64_t reference_timestamp_ns = 0;
+    if (!_motion_compensator.compensate(transformed_measurement_vec, reference_timestamp_ns)) {
+      reference_timestamp_ns = utils::systemTimeNs();
+    }
+
     LockGuard lock(_client_mutex);
     for (auto client : _clients) {
-      if (client)
+      if (client) {
+        utils::ScopedLatency latency(_client_latency[client]);
         client->onTransformedTofMeasurement(transformed_measurement_vec);
+      }
     }
-  }
-
-  return error_frames;
-}
 
-int MeasurementManagerImpl::notifyThermalData() {
-  int error_frames = 0;
-  std::vector<measurement::ThermalMeasurement> measurement_vec;
+    // Merge all sensors once instead of letting every client do it, but only if a client receives the merged cloud
+    if (!_ring_point_cloud_clients.empty()) {
+      _ring_point_cloud.assign(transformed_measurement_vec, reference_timestamp_ns);
 
-  for (const auto& sensor_bus : _sensor_ring->getInterfaces()) {
-    for (const auto& sensor_board : sensor_bus->getSensorBoards()) {
-      if (sensor_board->getThermal()->getEnable()) {
-        auto [measurement, error] = sensor_board->getThermal()->getLatestMeasurement();
-
-        if (error == sensor::SensorState::SensorOK) {
-          measurement_vec.emplace_back(measurement);
-        } else {
-          error_frames++;
+      for (auto client : _ring_point_cloud_clients) {
+        if (client) {
+          utils::ScopedLatency latency(_client_latency[client]);
+          client->onRingPointCloud(_ring_point_cloud);
         }
       }
     }
   }
+}
+
+void MeasurementManagerImpl::publishThermalData(const std::vector<measurement::ThermalMeasurement>& measurement_vec) {
+  PROFILE_ZONE("publishThermalData");
 
   if (!measurement_vec.empty()) {
+    PROFILE_FRAME("thermal");
+    PROFILE_PLOT_RATE("thermal fps");
+    _statistics.thermal_frames_published.fetch_add(1, std::memory_order_relaxed);
+
     LockGuard lock(_client_mutex);
     for (auto client : _clients) {
-      if (client)
+      if (client) {
+        utils::ScopedLatency latency(_client_latency[client]);
         client->onThermalMeasurement(measurement_vec);
+      }
     }
   }
-
-  return error_frames;
 }
 
 void MeasurementManagerImpl::notifyState(const ManagerState state) {
@@ -295,6 +475,8 @@ bool MeasurementManagerImpl::startMeasuring() noexcept {
 bool MeasurementManagerImpl::stopMeasuring() noexcept {
   if (_is_running) {
     _is_running = false;
+    if (_aggregator)
+      _aggregator->interrupt();
     notifyState(ManagerState::Shutdown);
   }
 
@@ -315,6 +497,8 @@ bool MeasurementManagerImpl::isMeasuring() noexcept {
 ==========================================================================================
 */
 void MeasurementManagerImpl::StateMachineWorker() noexcept {
+  PROFILE_THREAD("sensorring state machine");
+
   while (_is_running) {
     // no wait command here, the individual states of the state machine
     // provide natural throttling
@@ -322,12 +506,39 @@ void MeasurementManagerImpl::StateMachineWorker() noexcept {
       StateMachine();
     } catch (const std::exception& e) {
       logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Caught exception in state machine: " + std::string(e.what()));
+      stopPipelines();
       _measurement_state = MeasurementState::error_handler_communication;
     }
   }
+
+  stopPipelines();
+}
+
+bool MeasurementManagerImpl::startPipelines() {
+  // The pipelines are only used when the state machine runs in its own thread
+  if (_pipelines.empty() || !_is_running)
+    return false;
+
+  _aggregator->reset();
+  for (auto& pipeline : _pipelines) {
+    pipeline->setLight(_light_mode, _light_color[0], _light_color[1], _light_color[2]);
+    pipeline->start();
+  }
+  _light_update_flag = false;
+
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Started " + std::to_string(_pipelines.size()) + " parallel measurement pipelines.");
+  return true;
+}
+
+void MeasurementManagerImpl::stopPipelines() {
+  for (auto& pipeline : _pipelines) {
+    pipeline->stop();
+  }
 }
 
 void MeasurementManagerImpl::StateMachine() {
+  utils::ScopedLatency state_latency(_state_latency[static_cast<std::size_t>(_measurement_state.load())]);
+
   bool success = true;
   switch (_measurement_state) {
     /* =============================================
@@ -427,7 +638,80 @@ void MeasurementManagerImpl::StateMachine() {
     _last_thermal_measurement_timestamp = std::chrono::steady_clock::now();
 
     // state transition
-    _measurement_state = MeasurementState::set_lights;
+    _measurement_state = startPipelines() ? MeasurementState::run_pipelines : MeasurementState::set_lights;
+    break;
+  }
+
+    /* =============================================
+            Parallel part of the state machine
+            Each bus is measured in its own pipeline, the state machine only publishes the combined frames
+    ============================================= */
+
+  case MeasurementState::run_pipelines: {
+    if (_light_update_flag) {
+      for (auto& pipeline : _pipelines) {
+        pipeline->setLight(_light_mode, _light_color[0], _light_color[1], _light_color[2]);
+      }
+      _light_update_flag = false;
+    }
+
+    // check the health of the pipelines
+    bool recovering           = false;
+    bool measurement_failed   = false;
+    bool communication_failed = false;
+    for (const auto& pipeline : _pipelines) {
+      auto state = pipeline->getState();
+      recovering |= (state == PipelineState::Recovering);
+      measurement_failed |= (state == PipelineState::MeasurementFailed);
+      communication_failed |= (state == PipelineState::CommunicationFailed);
+    }
+
+    if (communication_failed || measurement_failed) {
+      notifyState(ManagerState::Error);
+      stopPipelines();
+
+      // state transition
+      if (!_params.repair_errors) {
+        _measurement_state = MeasurementState::shutdown;
+      } else if (communication_failed) {
+        logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Failed to restart communication. Please check the interfaces.");
+        _measurement_state = MeasurementState::shutdown;
+      } else {
+        logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Failed to restart measurements. Resetting all sensors.");
+        _measurement_state = MeasurementState::reset_sensors;
+      }
+      break;
+    }
+
+    notifyState(recovering ? ManagerState::Error : ManagerState::Running);
+
+    // publish the combined frames
+    {
+      PROFILE_ZONE("run_pipelines wait");
+      PROFILE_PLOT_DURATION("wait run_pipelines [ms]");
+      _aggregator->waitForData(_params.ring_params.timeout);
+    }
+
+    int error                   = 0;
+    std::size_t missing_buses   = 0;
+    std::size_t missing_sensors = 0;
+    if (_aggregator->takeTofFrame(_raw_tof_vec, _transformed_tof_vec, error, missing_buses, missing_sensors)) {
+      if (missing_buses != 0)
+        LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Publishing tof measurements without the data of " + std::to_string(missing_buses) + " interface(s)");
+      if (error != 0)
+        LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Error occurred while parsing tof measurements from " + std::to_string(error) + " sensor(s)");
+      _statistics.frames_dropped.fetch_add(static_cast<std::uint64_t>(error) + missing_sensors, std::memory_order_relaxed);
+      publishToFData(_raw_tof_vec, _transformed_tof_vec);
+    }
+
+    if (_aggregator->takeThermalFrame(_thermal_vec, error, missing_buses, missing_sensors)) {
+      if (missing_buses != 0)
+        LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Publishing thermal measurements without the data of " + std::to_string(missing_buses) + " interface(s)");
+      if (error != 0)
+        LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Error occurred while parsing thermal measurements from " + std::to_string(error) + " sensor(s)");
+      _statistics.frames_dropped.fetch_add(static_cast<std::uint64_t>(error) + missing_sensors, std::memory_order_relaxed);
+      publishThermalData(_thermal_vec);
+    }
     break;
   }
 
@@ -448,6 +732,7 @@ void MeasurementManagerImpl::StateMachine() {
   }
 
   case MeasurementState::request_tof_measurement: {
+    PROFILE_ZONE("request_tof_measurement");
     if (_tof_enabled)
       _sensor_ring->requestTofMeasurement();
     _last_tof_measurement_timestamp = std::chrono::steady_clock::now();
@@ -458,6 +743,7 @@ void MeasurementManagerImpl::StateMachine() {
   }
 
   case MeasurementState::request_thermal_measurement: {
+    PROFILE_ZONE("request_thermal_measurement");
     if (_thermal_enabled) {
       if (!_thermal_measurement_flag) {
         bool measure_thermal = true;
@@ -481,11 +767,18 @@ void MeasurementManagerImpl::StateMachine() {
   }
 
   case MeasurementState::wait_for_data: {
+    PROFILE_ZONE("wait_for_data");
+    PROFILE_PLOT_DURATION("wait wait_for_data [ms]");
+
     // wait for the completion of measurements if a frequency was specified
-    // or this is the first measurement
-    if (_is_tof_throttled || _first_measurement) {
-      if (_tof_enabled)
+    // or this is the first measurement. In pipelined mode the previous measurement
+    // is fetched while the sensors integrate the one that was just requested.
+    if ((_is_tof_throttled && !_params.pipeline_tof_measurements) || _first_measurement) {
+      if (_tof_enabled) {
         success &= _sensor_ring->waitForAllTofMeasurementsReady();
+        if (success)
+          _statistics.tof_request_to_ready.recordSince(_last_tof_measurement_timestamp);
+      }
     }
 
     // state transition
@@ -498,6 +791,7 @@ void MeasurementManagerImpl::StateMachine() {
         _measurement_state = MeasurementState::fetch_tof_data;
       }
     } else {
+      _statistics.timeouts.fetch_add(1, std::memory_order_relaxed);
       logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while waiting for completion of measurements.");
       _measurement_state = MeasurementState::error_handler_measurement;
     }
@@ -505,14 +799,20 @@ void MeasurementManagerImpl::StateMachine() {
   }
 
   case MeasurementState::fetch_tof_data: {
+    PROFILE_ZONE("fetch_tof_data");
+    PROFILE_PLOT_DURATION("wait fetch_tof_data [ms]");
+
     // fetch and publish a tof measurement
     if (_tof_enabled) {
+      const auto fetch_start = std::chrono::steady_clock::now();
       _sensor_ring->fetchTofMeasurement();
       success = _sensor_ring->waitForAllTofDataTransmissionsComplete();
       if (success) {
+        _statistics.tof_fetch_to_complete.recordSince(fetch_start);
         int error = notifyToFData();
+        _statistics.frames_dropped.fetch_add(static_cast<std::uint64_t>(error), std::memory_order_relaxed);
         if (error != 0)
-          logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Error occurred while parsing tof measurements from " + std::to_string(error) + " sensor(s)");
+          LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Error occurred while parsing tof measurements from " + std::to_string(error) + " sensor(s)");
       }
     }
 
@@ -520,6 +820,7 @@ void MeasurementManagerImpl::StateMachine() {
     if (success) {
       _measurement_state = MeasurementState::fetch_thermal_data;
     } else {
+      _statistics.timeouts.fetch_add(1, std::memory_order_relaxed);
       logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while fetching tof measurements.");
       _measurement_state = MeasurementState::error_handler_measurement;
     }
@@ -527,14 +828,20 @@ void MeasurementManagerImpl::StateMachine() {
   }
 
   case MeasurementState::fetch_thermal_data: {
+    PROFILE_ZONE("fetch_thermal_data");
+    PROFILE_PLOT_DURATION("wait fetch_thermal_data [ms]");
+
     // fetch and publish a thermal measurement
     if (_thermal_enabled && _thermal_measurement_flag) {
+      const auto fetch_start = std::chrono::steady_clock::now();
       _sensor_ring->fetchThermalMeasurement();
       success = _sensor_ring->waitForAllThermalDataTransmissionsComplete();
       if (success) {
+        _statistics.thermal_fetch_to_complete.recordSince(fetch_start);
         int error = notifyThermalData();
+        _statistics.frames_dropped.fetch_add(static_cast<std::uint64_t>(error), std::memory_order_relaxed);
         if (error != 0)
-          logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Error occurred while parsing thermal measurements from " + std::to_string(error) + " sensor(s)");
+          LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Error occurred while parsing thermal measurements from " + std::to_string(error) + " sensor(s)");
       }
       _thermal_measurement_flag = false;
     }
@@ -543,6 +850,7 @@ void MeasurementManagerImpl::StateMachine() {
     if (success) {
       _measurement_state = MeasurementState::throttle_measurement;
     } else {
+      _statistics.timeouts.fetch_add(1, std::memory_order_relaxed);
       logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while fetching thermal measurements.");
       _measurement_state = MeasurementState::error_handler_measurement;
     }
@@ -550,6 +858,9 @@ void MeasurementManagerImpl::StateMachine() {
   }
 
   case MeasurementState::throttle_measurement: {
+    PROFILE_ZONE("throttle_measurement");
+    PROFILE_PLOT_DURATION("wait throttle_measurement [ms]");
+
     if (_tof_enabled && _is_tof_throttled) {
       // throttled mode: wait until next measurement period
       std::this_thread::sleep_until(_last_tof_measurement_timestamp + _tof_measurement_period);
@@ -559,8 +870,11 @@ void MeasurementManagerImpl::StateMachine() {
 
     // state transition
     if (success) {
+      if (_tof_enabled)
+        _statistics.tof_request_to_ready.recordSince(_last_tof_measurement_timestamp);
       _measurement_state = MeasurementState::set_lights;
     } else {
+      _statistics.timeouts.fetch_add(1, std::memory_order_relaxed);
       logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Timeout occurred while taking tof measurements.");
       _measurement_state = MeasurementState::error_handler_measurement;
     }
@@ -596,7 +910,7 @@ void MeasurementManagerImpl::StateMachine() {
     if (_params.repair_errors) {
       if (success) {
         logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Restarting measurements succeeded after " + std::to_string(attempts) + " attempts.");
-        _measurement_state = MeasurementState::set_lights;
+        _measurement_state = startPipelines() ? MeasurementState::run_pipelines : MeasurementState::set_lights;
         _light_update_flag = true;
         notifyState(ManagerState::Running);
       } else {
@@ -650,7 +964,7 @@ void MeasurementManagerImpl::StateMachine() {
     if (_params.repair_errors) {
       if (success) {
         logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "Restarting communication succeeded after " + std::to_string(attempts) + " attempts.");
-        _measurement_state = MeasurementState::set_lights;
+        _measurement_state = startPipelines() ? MeasurementState::run_pipelines : MeasurementState::set_lights;
         _light_update_flag = true;
         notifyState(ManagerState::Running);
       } else {
@@ -670,6 +984,7 @@ void MeasurementManagerImpl::StateMachine() {
 
   case MeasurementState::shutdown: {
     logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "Shutting down state machine.");
+    stopPipelines();
     notifyState(ManagerState::Shutdown);
     _is_running = false;
     break;
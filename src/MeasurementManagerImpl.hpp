@@ -1,15 +1,22 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "sensorring/MeasurementClient.hpp"
 #include "sensorring/Parameter.hpp"
+#include "sensorring/types/Statistics.hpp"
+#include "utils/LatencyRecorder.hpp"
 
+#include "BusPipeline.hpp"
+#include "MotionCompensator.hpp"
 #include "SensorRing.hpp"
 
 namespace eduart {
@@ -65,6 +72,13 @@ class MeasurementManagerImpl {
    */
   void registerClient(MeasurementClient* client) noexcept;
 
+  /**
+   * Register an client with the MeasurementManager object
+   * @param[in] client Observer that is registered and gets notified on future events
+   * @param[in] ring_point_cloud true if the client receives the merged ring point cloud
+   */
+  void registerClient(MeasurementClient* client, bool ring_point_cloud) noexcept;
+
   /**
    * Unregister an client with the MeasurementManager object
    * @param[in] client Observer that is unregistered and will not be notified on future events
@@ -124,6 +138,18 @@ class MeasurementManagerImpl {
    */
   void setLight(light::LightMode mode, std::uint8_t red = 0, std::uint8_t green = 0, std::uint8_t blue = 0) noexcept;
 
+  /**
+   * Add an ego-motion sample for the motion compensation of the transformed Time-of-Flight measurements
+   * @param[in] motion velocity of the robot
+   */
+  void pushEgoMotion(const measurement::EgoMotion& motion) noexcept;
+
+  /**
+   * Get a snapshot of the runtime statistics
+   * @return statistics accumulated since construction
+   */
+  Statistics getStatistics() const;
+
 private:
   enum class MeasurementState {
     init,
@@ -139,16 +165,25 @@ class MeasurementManagerImpl {
     fetch_thermal_data,
     wait_for_data,
     throttle_measurement,
+    run_pipelines,
     error_handler_measurement,
     error_handler_communication,
     shutdown
   };
 
+  static constexpr std::size_t STATE_COUNT = static_cast<std::size_t>(MeasurementState::shutdown) + 1;
+  static const char* getStateName(MeasurementState state);
+
   void StateMachine();
   void StateMachineWorker() noexcept;
 
+  bool startPipelines();
+  void stopPipelines();
+
   int notifyToFData();
   int notifyThermalData();
+  void publishToFData(const std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec);
+  void publishThermalData(const std::vector<measurement::ThermalMeasurement>& measurement_vec);
   void notifyState(const ManagerState state);
 
   const ManagerParams _params;
@@ -156,8 +191,8 @@ class MeasurementManagerImpl {
   std::atomic<MeasurementState> _measurement_state;
   std::unique_ptr<ring::SensorRing> _sensor_ring;
 
-  bool _tof_enabled;
-  bool _thermal_enabled;
+  std::atomic<bool> _tof_enabled;
+  std::atomic<bool> _thermal_enabled;
   bool _first_measurement;
   std::chrono::duration<double> _tof_measurement_period;
   std::chrono::duration<double> _thermal_measurement_period;
@@ -173,9 +208,22 @@ class MeasurementManagerImpl {
   std::uint8_t _light_brightness;
   std::atomic<bool> _light_update_flag;
 
+  PipelineStatistics _statistics;
+  std::array<utils::LatencyRecorder, STATE_COUNT> _state_latency;
+
+  std::unique_ptr<MeasurementAggregator> _aggregator;
+  std::vector<std::unique_ptr<BusPipeline> > _pipelines;
+  std::vector<measurement::TofMeasurement> _raw_tof_vec;
+  std::vector<measurement::TofMeasurement> _transformed_tof_vec;
+  std::vector<measurement::ThermalMeasurement> _thermal_vec;
+  measurement::RingPointCloud _ring_point_cloud;
+  MotionCompensator _motion_compensator;
+
   mutable std::mutex _client_mutex;
   using LockGuard = std::lock_guard<std::mutex>;
   std::set<MeasurementClient*> _clients;
+  std::set<MeasurementClient*> _ring_point_cloud_clients;
+  std::map<const MeasurementClient*, utils::LatencyRecorder> _client_latency;
 
   std::atomic<bool> _is_running;
   std::thread _worker_thread;
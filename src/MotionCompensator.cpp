@@ -0,0 +1,92 @@
+#include "MotionCompensator.hpp"
+
+#include <algorithm>
+
+#include "sensorring/math/Math.hpp"
+
+namespace eduart {
+
+namespace manager {
+
+namespace {
+
+math::Matrix3 transpose(const math::Matrix3& m) {
+  math::Matrix3 result;
+  for (std::size_t i = 0; i < 3; i++) {
+    for (std::size_t j = 0; j < 3; j++) {
+      result[i][j] = m[j][i];
+    }
+  }
+  return result;
+}
+
+std::uint64_t distance(std::uint64_t a, std::uint64_t b) {
+  return (a > b) ? (a - b) : (b - a);
+}
+
+} // namespace
+
+MotionCompensator::MotionCompensator() {
+}
+
+void MotionCompensator::push(const measurement::EgoMotion& motion) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _samples.push_back(motion);
+  if (_samples.size() > MAX_SAMPLES) {
+    _samples.pop_front();
+  }
+}
+
+bool MotionCompensator::findSample(std::uint64_t timestamp_ns, measurement::EgoMotion& motion) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto nearest = std::min_element(_samples.begin(), _samples.end(), [timestamp_ns](const auto& a, const auto& b) { return distance(a.timestamp_ns, timestamp_ns) < distance(b.timestamp_ns, timestamp_ns); });
+  if (nearest == _samples.end() || distance(nearest->timestamp_ns, timestamp_ns) > MAX_SAMPLE_DISTANCE_NS) {
+    return false;
+  }
+
+  motion = *nearest;
+  return true;
+}
+
+bool MotionCompensator::compensate(std::vector<measurement::TofMeasurement>& measurement_vec, std::uint64_t& reference_timestamp_ns) {
+  reference_timestamp_ns = 0;
+  for (const auto& measurement : measurement_vec) {
+    reference_timestamp_ns = std::max(reference_timestamp_ns, measurement.last_rx_timestamp_ns);
+  }
+
+  bool compensated = false;
+  for (auto& measurement : measurement_vec) {
+    if (measurement.last_rx_timestamp_ns == 0) {
+      continue;
+    }
+
+    // the velocity in the middle of the interval approximates the mean velocity
+    const std::uint64_t skew_ns = reference_timestamp_ns - measurement.last_rx_timestamp_ns;
+    measurement::EgoMotion motion;
+    if (!findSample(measurement.last_rx_timestamp_ns + skew_ns / 2, motion)) {
+      continue;
+    }
+    compensated = true;
+
+    if (skew_ns == 0) {
+      continue;
+    }
+
+    // Movement of the ring between the measurement and the reference time. A static point p is seen at
+    // rot^T * (p - translation) from the pose at the reference time.
+    const double dt                 = static_cast<double>(skew_ns) * 1e-9;
+    const math::Matrix3 rot_t       = transpose(math::rotMatrixFromEulerRadians(motion.angular_velocity * dt));
+    const math::Vector3 translation = rot_t * (motion.linear_velocity * dt);
+
+    for (auto& point : measurement.point_cloud.data) {
+      point.point = rot_t * point.point - translation;
+    }
+  }
+
+  return compensated;
+}
+
+} // namespace manager
+
+} // namespace eduart
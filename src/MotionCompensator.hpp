@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "sensorring/types/EgoMotion.hpp"
+#include "sensorring/types/TofMeasurement.hpp"
+
+namespace eduart {
+
+namespace manager {
+
+/**
+ * @class MotionCompensator
+ * @brief Removes the skew between the sensors of a ring that is caused by the robot moving while the sensors finish
+ * their measurements at different times. The points of every sensor are moved to the position they would have had at
+ * a common reference time, which is the receive time of the newest measurement. The motion between the two times is
+ * taken from the pushed ego-motion samples with a constant velocity model.
+ */
+class MotionCompensator {
+public:
+  /**
+   * Constructor
+   */
+  MotionCompensator();
+
+  /**
+   * Add an ego-motion sample. Samples must be pushed in chronological order. Thread safe.
+   * @param[in] motion velocity of the robot
+   */
+  void push(const measurement::EgoMotion& motion);
+
+  /**
+   * Move the points of all measurements to the reference time. Measurements are left unchanged if there is no
+   * ego-motion sample close enough to their receive time.
+   * @param[in,out] measurement_vec transformed measurements of all sensors
+   * @param[out] reference_timestamp_ns time to which the points were moved in nanoseconds since the epoch
+   * @return true if the measurements were compensated
+   */
+  bool compensate(std::vector<measurement::TofMeasurement>& measurement_vec, std::uint64_t& reference_timestamp_ns);
+
+private:
+  bool findSample(std::uint64_t timestamp_ns, measurement::EgoMotion& motion) const;
+
+  // Number of kept samples, enough for odometry at several hundred Hz
+  static constexpr std::size_t MAX_SAMPLES = 256;
+
+  // Samples further away from a measurement are considered outdated
+  static constexpr std::uint64_t MAX_SAMPLE_DISTANCE_NS = 500000000;
+
+  mutable std::mutex _mutex;
+  std::deque<measurement::EgoMotion> _samples;
+};
+
+} // namespace manager
+
+} // namespace eduart
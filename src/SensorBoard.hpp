@@ -32,7 +32,7 @@ class SensorBoard : public com::ComObserver {
   static void cmdSetBrs(com::ComInterface* interface, bool enable);
   static void cmdEnumerateBoards(com::ComInterface* interface);
 
-  void notify(const com::ComEndpoint source, const std::vector<uint8_t>& data) override;
+  void notify(const com::ComEndpoint& source, ByteSpan data) override;
 
 private:
   int _idx;
@@ -97,6 +97,13 @@ void SensorBus::resetDevices() {
   sensor::SensorBoard::cmdReset(_interface);
 }
 
+void SensorBus::setCompletionSignal(utils::CompletionSignal* signal) {
+  for (auto& sensor : _board_vec) {
+    sensor->getTof()->setCompletionSignal(signal);
+    sensor->getThermal()->setCompletionSignal(signal);
+  }
+}
+
 void SensorBus::resetSensorState() {
   for (auto& sensor : _board_vec) {
     sensor->getTof()->resetSensorState();
@@ -264,6 +271,52 @@ bool SensorBus::allThermalDataTransmissionsComplete(unsigned int& ready_sensors_
   return _active_thermal_sensors == ready_sensors_count;
 }
 
+int SensorBus::getLatestTofMeasurements(std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec) const {
+  int error_frames = 0;
+
+  for (const auto& sensor_board : _board_vec) {
+    if (sensor_board->getTof()->getEnable()) {
+      // fetch the most recent complete frame that the listener thread published
+      sensor_board->getTof()->updateLatestMeasurement();
+
+      auto [raw_measurement, raw_error] = sensor_board->getTof()->getLatestRawMeasurement();
+      if (raw_error == sensor::SensorState::SensorOK) {
+        if (!raw_measurement.point_cloud.data.empty())
+          raw_measurement_vec.emplace_back(raw_measurement);
+      } else {
+        error_frames++;
+      }
+
+      auto [transformed_measurement, transformed_error] = sensor_board->getTof()->getLatestTransformedMeasurement();
+      if (transformed_error == sensor::SensorState::SensorOK) {
+        if (!transformed_measurement.point_cloud.data.empty())
+          transformed_measurement_vec.emplace_back(transformed_measurement);
+      }
+    }
+  }
+
+  return error_frames;
+}
+
+int SensorBus::getLatestThermalMeasurements(std::vector<measurement::ThermalMeasurement>& measurement_vec) const {
+  int error_frames = 0;
+
+  for (const auto& sensor_board : _board_vec) {
+    if (sensor_board->getThermal()->getEnable()) {
+      sensor_board->getThermal()->updateLatestMeasurement();
+      auto [measurement, error] = sensor_board->getThermal()->getLatestMeasurement();
+
+      if (error == sensor::SensorState::SensorOK) {
+        measurement_vec.emplace_back(measurement);
+      } else {
+        error_frames++;
+      }
+    }
+  }
+
+  return error_frames;
+}
+
 bool SensorBus::stopThermalCalibration() {
   bool success = true;
 
@@ -284,9 +337,11 @@ bool SensorBus::startThermalCalibration(std::size_t window) {
   return success;
 }
 
-void SensorBus::notify([[maybe_unused]] const com::ComEndpoint source, [[maybe_unused]] const std::vector<uint8_t>& data) {
+void SensorBus::notify([[maybe_unused]] const com::ComEndpoint& source, [[maybe_unused]] ByteSpan data) {
+
+  static const com::ComEndpoint broadcast_endpoint("broadcast");
 
-  if (source == com::ComEndpoint("broadcast")) { // general sensor board status
+  if (source == broadcast_endpoint) { // general sensor board status
     // enumeration message
     if (_enumeration_flag && data.size() == 12 && data.at(0) == CMD_ACTIVE_DEVICE_RESPONSE) {
 
@@ -5,6 +5,7 @@
 
 #include "interface/ComInterface.hpp"
 #include "interface/ComObserver.hpp"
+#include "utils/CompletionSignal.hpp"
 
 #include "SensorBoard.hpp"
 
@@ -37,6 +38,10 @@ class SensorBus : public com::ComObserver {
   bool allThermalDataTransmissionsComplete(unsigned int& ready_sensors_count) const;
   bool allEEPROMTransmissionsComplete() const;
 
+  int getLatestTofMeasurements(std::vector<measurement::TofMeasurement>& raw_measurement_vec, std::vector<measurement::TofMeasurement>& transformed_measurement_vec) const;
+  int getLatestThermalMeasurements(std::vector<measurement::ThermalMeasurement>& measurement_vec) const;
+
+  void setCompletionSignal(utils::CompletionSignal* signal);
   void resetDevices();
   void resetSensorState();
   int enumerateDevices();
@@ -52,7 +57,7 @@ class SensorBus : public com::ComObserver {
   bool stopThermalCalibration();
   bool startThermalCalibration(std::size_t window);
 
-  void notify(const com::ComEndpoint source, const std::vector<uint8_t>& data) override;
+  void notify(const com::ComEndpoint& source, ByteSpan data) override;
 
 private:
   com::ComInterface* _interface;
@@ -21,9 +21,17 @@ SensorRing::SensorRing(RingParams params, std::vector<std::unique_ptr<bus::Senso
   } else if (_params.timeout < 200ms) {
     logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "SensorRing timeout parameter of " + std::to_string(_params.timeout.count()) + " ms is probably too low");
   }
+
+  // the sensors wake up the waiting state machine worker when they received new data
+  for (auto& sensor_bus : _bus_vec) {
+    sensor_bus->setCompletionSignal(&_completion_signal);
+  }
 }
 
 SensorRing::~SensorRing() {
+  for (auto& sensor_bus : _bus_vec) {
+    sensor_bus->setCompletionSignal(nullptr);
+  }
 }
 
 std::vector<const bus::SensorBus*> SensorRing::getInterfaces() const {
@@ -36,6 +44,10 @@ std::vector<const bus::SensorBus*> SensorRing::getInterfaces() const {
   return ref_vec;
 }
 
+std::size_t SensorRing::getBusCount() const {
+  return _bus_vec.size();
+}
+
 void SensorRing::resetSensorState() {
   for (auto& sensor_bus : _bus_vec) {
     sensor_bus->resetSensorState();
@@ -86,20 +98,13 @@ bool SensorRing::getEEPROM() {
   }
 
   // wait until all sensors sent their response. Timeout protected
-  bool ready     = false;
-  auto timestamp = std::chrono::steady_clock::now();
-
-  do {
-    ready = true;
+  return _completion_signal.waitFor(_params.timeout, [this]() {
+    bool ready = true;
     for (auto& sensor_bus : _bus_vec) {
       ready &= sensor_bus->allEEPROMTransmissionsComplete();
     }
-    if (!ready) {
-      std::this_thread::sleep_for(std::chrono::microseconds(100));
-    }
-  } while (!ready && (std::chrono::steady_clock::now() - timestamp) < _params.timeout);
-
-  return ready;
+    return ready;
+  });
 }
 
 void SensorRing::requestTofMeasurement() {
@@ -109,21 +114,13 @@ void SensorRing::requestTofMeasurement() {
 }
 
 bool SensorRing::waitForAllTofMeasurementsReady() const {
-
-  bool ready     = false;
-  auto timestamp = std::chrono::steady_clock::now();
-
-  do {
-    ready = true;
+  return _completion_signal.waitFor(_params.timeout, [this]() {
+    bool ready = true;
     for (auto& sensor_bus : _bus_vec) {
       ready &= sensor_bus->allTofMeasurementsReady();
     }
-    if (!ready) {
-      std::this_thread::sleep_for(std::chrono::microseconds(1));
-    }
-  } while (!ready && ((std::chrono::steady_clock::now() - timestamp) < _params.timeout));
-
-  return ready;
+    return ready;
+  });
 }
 
 bool SensorRing::waitForAllThermalMeasurementsReady() const {
@@ -145,37 +142,23 @@ bool SensorRing::waitForAllThermalMeasurementsReady() const {
 }
 
 bool SensorRing::waitForAllTofDataTransmissionsComplete() const {
-  bool ready     = false;
-  auto timestamp = std::chrono::steady_clock::now();
-
-  do {
-    ready = true;
+  return _completion_signal.waitFor(_params.timeout, [this]() {
+    bool ready = true;
     for (auto& sensor_bus : _bus_vec) {
       ready &= sensor_bus->allTofDataTransmissionsComplete();
     }
-    if (!ready) {
-      std::this_thread::sleep_for(std::chrono::microseconds(1));
-    }
-  } while (!ready && (std::chrono::steady_clock::now() - timestamp) < _params.timeout);
-
-  return ready;
+    return ready;
+  });
 }
 
 bool SensorRing::waitForAllThermalDataTransmissionsComplete() const {
-  bool ready     = false;
-  auto timestamp = std::chrono::steady_clock::now();
-
-  do {
-    ready = true;
+  return _completion_signal.waitFor(_params.timeout, [this]() {
+    bool ready = true;
     for (auto& sensor_bus : _bus_vec) {
       ready &= sensor_bus->allThermalDataTransmissionsComplete();
     }
-    if (!ready) {
-      std::this_thread::sleep_for(std::chrono::microseconds(1));
-    }
-  } while (!ready && (std::chrono::steady_clock::now() - timestamp) < _params.timeout);
-
-  return ready;
+    return ready;
+  });
 }
 
 void SensorRing::fetchTofMeasurement() {
@@ -196,6 +179,51 @@ void SensorRing::fetchThermalMeasurement() {
   }
 }
 
+void SensorRing::setLight(std::size_t bus_idx, light::LightMode mode, std::uint8_t red, std::uint8_t green, std::uint8_t blue) {
+  _bus_vec.at(bus_idx)->setLight(mode, red, green, blue);
+}
+
+void SensorRing::resetSensorState(std::size_t bus_idx) {
+  _bus_vec.at(bus_idx)->resetSensorState();
+}
+
+void SensorRing::requestTofMeasurement(std::size_t bus_idx) {
+  _bus_vec.at(bus_idx)->requestTofMeasurement();
+}
+
+void SensorRing::fetchTofMeasurement(std::size_t bus_idx) {
+  _bus_vec.at(bus_idx)->fetchTofMeasurement();
+}
+
+void SensorRing::requestThermalMeasurement(std::size_t bus_idx) {
+  _bus_vec.at(bus_idx)->requestThermalMeasurement();
+}
+
+void SensorRing::fetchThermalMeasurement(std::size_t bus_idx) {
+  _bus_vec.at(bus_idx)->fetchThermalMeasurement();
+}
+
+bool SensorRing::waitForAllTofMeasurementsReady(std::size_t bus_idx) const {
+  const auto& sensor_bus = _bus_vec.at(bus_idx);
+  return _completion_signal.waitFor(_params.timeout, [&sensor_bus]() {
+    return sensor_bus->allTofMeasurementsReady();
+  });
+}
+
+bool SensorRing::waitForAllTofDataTransmissionsComplete(std::size_t bus_idx) const {
+  const auto& sensor_bus = _bus_vec.at(bus_idx);
+  return _completion_signal.waitFor(_params.timeout, [&sensor_bus]() {
+    return sensor_bus->allTofDataTransmissionsComplete();
+  });
+}
+
+bool SensorRing::waitForAllThermalDataTransmissionsComplete(std::size_t bus_idx) const {
+  const auto& sensor_bus = _bus_vec.at(bus_idx);
+  return _completion_signal.waitFor(_params.timeout, [&sensor_bus]() {
+    return sensor_bus->allThermalDataTransmissionsComplete();
+  });
+}
+
 bool SensorRing::stopThermalCalibration() {
   bool success = true;
 
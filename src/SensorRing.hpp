@@ -5,6 +5,8 @@
 
 #include "sensorring/Parameter.hpp"
 
+#include "utils/CompletionSignal.hpp"
+
 #include "SensorBus.hpp"
 
 
@@ -19,6 +21,7 @@ class SensorRing {
   ~SensorRing();
 
   std::vector<const bus::SensorBus*> getInterfaces() const;
+  std::size_t getBusCount() const;
 
   void setBrs(bool brs_enable);
   void syncLight();
@@ -39,9 +42,22 @@ class SensorRing {
   bool waitForAllThermalMeasurementsReady() const;
   bool waitForAllThermalDataTransmissionsComplete() const;
 
+  // Operations on a single bus. Different buses may be driven from different threads.
+  void setLight(std::size_t bus_idx, light::LightMode mode, std::uint8_t red, std::uint8_t green, std::uint8_t blue);
+  void resetSensorState(std::size_t bus_idx);
+  void requestTofMeasurement(std::size_t bus_idx);
+  void fetchTofMeasurement(std::size_t bus_idx);
+  void requestThermalMeasurement(std::size_t bus_idx);
+  void fetchThermalMeasurement(std::size_t bus_idx);
+
+  bool waitForAllTofMeasurementsReady(std::size_t bus_idx) const;
+  bool waitForAllTofDataTransmissionsComplete(std::size_t bus_idx) const;
+  bool waitForAllThermalDataTransmissionsComplete(std::size_t bus_idx) const;
+
 private:
   const RingParams _params;
   std::vector<std::unique_ptr<bus::SensorBus> > _bus_vec;
+  mutable utils::CompletionSignal _completion_signal;
 };
 
 } // namespace ring
@@ -3,6 +3,7 @@
 #include <string_view>
 #include <unordered_map>
 
+#include "sensorring/Parameter.hpp"
 #include "sensorring/math/Math.hpp"
 
 namespace eduart {
@@ -73,6 +74,8 @@ class SensorBoardManager {
 
   static inline TofSensorInfo getToFSensorInfo(TofType type) { return tofSensorDatabase.at(type); }
 
+  static inline TofSensorInfo getToFSensorInfo(TofType type, TofResolution resolution) { return (resolution == TofResolution::res_4x4) ? tofSensorDatabase4x4.at(type) : tofSensorDatabase.at(type); }
+
   static inline ThermalSensorInfo getThermalSensorInfo(ThermalType type) { return thermalSensorDatabase.at(type); }
 
   static inline SensorBoardInfo getSensorBoardInfo(SensorBoardType type) { return sensorBoardDatabase.at(type); }
@@ -90,6 +93,12 @@ class SensorBoardManager {
     { TofType::VL53L8, { "ST VL53L8CX", 45.0, 45.0, 8, 8, 15.0, { 0, 0, 0 }, { 0, 0, 0 } } }
   };
 
+  // 4x4 zones are binned from 8x8 measurements, so the rate is the same
+  static inline const std::unordered_map<TofType, TofSensorInfo> tofSensorDatabase4x4 = {
+    { TofType::None,   { "none", 0.0, 0.0, 0, 0, 0.0, { 0, 0, 0 }, { 0, 0, 0 } }           },
+    { TofType::VL53L8, { "ST VL53L8CX", 45.0, 45.0, 4, 4, 15.0, { 0, 0, 0 }, { 0, 0, 0 } } }
+  };
+
   static inline const std::unordered_map<ThermalType, ThermalSensorInfo> thermalSensorDatabase = {
     { ThermalType::None,   { "none", 0, 0, 0.0, { 0, 0, 0 }, { 0, 0, 0 } }                  },
     { ThermalType::HTPA32, { "Heimann HTPA32", 32, 32, 15.0, { 0.013, 0, 0 }, { 0, 0, 0 } } }
@@ -1,5 +1,10 @@
 #include "ComInterface.hpp"
 
+#include <stdexcept>
+
+#include "log/FrameRecorder.hpp"
+#include "utils/Clock.hpp"
+
 namespace eduart {
 
 namespace com {
@@ -8,8 +13,11 @@ ComInterface::ComInterface()
     : _communication_error(false)
     , _listener_is_running(false)
     , _shut_down_listener(false)
+    , _tx_frame_gap(std::chrono::microseconds(2000))
     , _interface_name("")
-    , _thread{nullptr} {
+    , _dispatch_table(DISPATCH_TABLE_SIZE)
+    , _thread{nullptr}
+    , _recording(false) {
 }
 
 ComInterface::~ComInterface() {
@@ -21,11 +29,12 @@ std::string ComInterface::getInterfaceName() const {
 }
 
 bool ComInterface::registerObserver(ComObserver* observer) {
-  LockGuard guard(_mutex);
+  LockGuard guard(_observer_mutex);
   if (observer) {
     auto result = _observers.insert(observer);
 
     if (result.second) {
+      rebuildDispatchTable();
       return true;
     }
   }
@@ -33,11 +42,12 @@ bool ComInterface::registerObserver(ComObserver* observer) {
 }
 
 bool ComInterface::unregisterObserver(ComObserver* observer) {
-  LockGuard guard(_mutex);
+  LockGuard guard(_observer_mutex);
   if (observer) {
     auto result = _observers.erase(observer);
 
     if (result > 0) {
+      rebuildDispatchTable();
       return true;
     }
   }
@@ -45,8 +55,69 @@ bool ComInterface::unregisterObserver(ComObserver* observer) {
 }
 
 void ComInterface::clearObservers() {
-  LockGuard guard(_mutex);
+  LockGuard guard(_observer_mutex);
   _observers.clear();
+  rebuildDispatchTable();
+}
+
+void ComInterface::updateDispatchTable() {
+  LockGuard guard(_observer_mutex);
+  rebuildDispatchTable();
+}
+
+void ComInterface::rebuildDispatchTable() {
+  for (auto& entry : _dispatch_table) {
+    entry.endpoint.reset();
+    entry.observers.clear();
+  }
+
+  for (const auto& endpoint : _endpoints) {
+    try {
+      auto id = mapEndpointToId(endpoint);
+      if (id < DISPATCH_TABLE_SIZE) {
+        _dispatch_table[id].endpoint = std::make_unique<ComEndpoint>(endpoint);
+      }
+    } catch (const std::out_of_range&) {
+      // endpoint is not mapped to an id yet
+    }
+  }
+
+  for (const auto& observer : _observers) {
+    if (!observer)
+      continue;
+
+    for (const auto& endpoint : observer->getEndpoints()) {
+      try {
+        auto id = mapEndpointToId(endpoint);
+        if (id < DISPATCH_TABLE_SIZE && _dispatch_table[id].endpoint) {
+          _dispatch_table[id].observers.push_back(observer);
+        }
+      } catch (const std::out_of_range&) {
+        // endpoint is not mapped to an id yet
+      }
+    }
+  }
+}
+
+bool ComInterface::notifyObservers(std::uint32_t id, ByteSpan data, std::uint64_t rx_timestamp_ns) {
+  if (_recording) {
+    if (auto recorder = std::atomic_load(&_recorder)) {
+      recorder->record(framelog::Direction::Rx, id, data.data(), data.size(), rx_timestamp_ns);
+    }
+  }
+
+  if (id >= DISPATCH_TABLE_SIZE)
+    return false;
+
+  LockGuard guard(_observer_mutex);
+  const auto& entry = _dispatch_table[id];
+  if (!entry.endpoint)
+    return false;
+
+  for (const auto& observer : entry.observers) {
+    observer->forwardNotification(*entry.endpoint, data, rx_timestamp_ns);
+  }
+  return true;
 }
 
 bool ComInterface::startListener() {
@@ -68,10 +139,40 @@ void ComInterface::stopListener() {
   }
 }
 
+void ComInterface::recordTx(std::uint32_t id, const std::vector<std::uint8_t>& data) {
+  if (_recording) {
+    if (auto recorder = std::atomic_load(&_recorder)) {
+      recorder->record(framelog::Direction::Tx, id, data.data(), data.size(), utils::systemTimeNs());
+    }
+  }
+}
+
+bool ComInterface::startRecording(const std::string& filename) {
+  auto recorder = std::make_shared<FrameRecorder>();
+  if (!recorder->open(filename)) {
+    return false;
+  }
+
+  std::atomic_store(&_recorder, recorder);
+  _recording = true;
+  return true;
+}
+
+void ComInterface::stopRecording() {
+  _recording = false;
+
+  // the last frame that is recorded concurrently keeps the recorder alive until it is written
+  std::atomic_store(&_recorder, std::shared_ptr<FrameRecorder>());
+}
+
 const std::set<ComEndpoint>& ComInterface::getEndpoints() const {
   return _endpoints;
 }
 
+void ComInterface::setTxFrameGap(std::chrono::microseconds gap) {
+  _tx_frame_gap = gap;
+}
+
 bool ComInterface::hasError() const {
   return _communication_error;
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
@@ -15,6 +17,8 @@ namespace eduart {
 
 namespace com {
 
+class FrameRecorder;
+
 class ComInterface {
 
 public:
@@ -95,12 +99,30 @@ class ComInterface {
    */
   virtual bool repairInterface() = 0;
 
+  /**
+   * Set the minimal time between two frames sent on the interface. Interfaces without a transmit queue ignore it.
+   * @param[in] gap minimal inter-frame gap, 0 sends queued frames back to back
+   */
+  void setTxFrameGap(std::chrono::microseconds gap);
+
   /**
    * Check if a communication error has occurred.
    * @return error==true
    */
   bool hasError() const;
 
+  /**
+   * Record all frames that are sent and received on this interface to a frame log. A running recording is replaced.
+   * @param[in] filename path of the log file, an existing file is overwritten
+   * @return success==true
+   */
+  bool startRecording(const std::string& filename);
+
+  /**
+   * Stop a running recording and close the log file
+   */
+  void stopRecording();
+
   /**
    * Add endpoint for a new tof sensor
    * @param[in] idx index of the sensor
@@ -118,22 +140,72 @@ class ComInterface {
 
   virtual bool listener() = 0;
 
+  /**
+   * Map a ComEndpoint to the id that is used on the bus.
+   * @param[in] endpoint ComEndpoint to map
+   * @return id of the endpoint, throws std::out_of_range for unknown endpoints
+   */
+  virtual std::uint32_t mapEndpointToId(const ComEndpoint& endpoint) const = 0;
+
+  /**
+   * Rebuild the dispatch table. Must be called whenever a new endpoint is mapped to an id.
+   */
+  void updateDispatchTable();
+
+  /**
+   * Forward an incoming message to all observers of the endpoint with the given id. The lookup is a single table access
+   * and only the observer mutex is locked, so the listener does not block concurrent send calls.
+   * @param[in] id id of the received message
+   * @param[in] data Message payload
+   * @param[in] rx_timestamp_ns receive time of the message in nanoseconds since the epoch of the system clock
+   * @return true if the id is mapped to a known endpoint
+   */
+  bool notifyObservers(std::uint32_t id, ByteSpan data, std::uint64_t rx_timestamp_ns);
+
+  /**
+   * Record a sent message if a recording is running. Must be called by the send method of every interface.
+   * @param[in] id id of the sent message
+   * @param[in] data Message payload
+   */
+  void recordTx(std::uint32_t id, const std::vector<std::uint8_t>& data);
+
   std::atomic<bool> _communication_error;
 
   std::atomic<bool> _listener_is_running;
 
   std::atomic<bool> _shut_down_listener;
 
+  std::atomic<std::chrono::microseconds> _tx_frame_gap;
+
   std::string _interface_name;
 
   std::mutex _mutex;
 
   std::set<ComEndpoint> _endpoints;
 
+  std::mutex _observer_mutex;
+
   std::set<ComObserver*> _observers;
 
 private:
+  struct DispatchEntry {
+    std::unique_ptr<ComEndpoint> endpoint;
+    std::vector<ComObserver*> observers;
+  };
+
+  void rebuildDispatchTable();
+
+  // Dense table indexed with the 11-bit standard CAN id
+  static constexpr std::size_t DISPATCH_TABLE_SIZE = 0x800;
+
+  std::vector<DispatchEntry> _dispatch_table;
+
   std::unique_ptr<std::thread> _thread;
+
+  // Only accessed with the atomic shared_ptr functions, the flag avoids them while nothing is recorded
+  std::shared_ptr<FrameRecorder> _recorder;
+
+  std::atomic<bool> _recording;
 };
 
 } // namespace com
@@ -2,6 +2,9 @@
 
 #include "sensorring/logger/Logger.hpp"
 
+#include "log/ReplayInterface.hpp"
+#include "sim/SimulatedInterface.hpp"
+
 #ifdef USE_SOCKETCAN
 #include "can/SocketCANFD.hpp"
 #endif
@@ -16,7 +19,9 @@ namespace eduart {
 
 namespace com {
 
-ComInterface* ComManager::createInterface(std::string interface_name, InterfaceType type) {
+ComInterface* ComManager::createInterface(const bus::BusParams& bus_params) {
+  const auto& interface_name = bus_params.interface_name;
+  const auto type            = bus_params.type;
 
   // Check if interface altready exists
   const auto& it = std::find_if(_interfaces.begin(), _interfaces.end(), [&interface_name](const auto& interface) {
@@ -25,9 +30,11 @@ ComInterface* ComManager::createInterface(std::string interface_name, InterfaceT
   if (it != _interfaces.end())
     return it->get();
 
-  // No interface options specified
+  // No interface options specified, only the simulated and replay interfaces are available
 #if !(defined(USE_SOCKETCAN) || defined(USE_USBTINGO))
-  logger::Logger::getInstance()->log(logger::LogVerbosity::Exception, "Built sensorring library without any interface options. Unable to open any communication interface.");
+  if (type != InterfaceType::SIMULATED && type != InterfaceType::REPLAY) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Exception, "Built sensorring library without any interface options. Unable to open any communication interface.");
+  }
 #endif
 
   // Interface does not exist, create a new one
@@ -50,6 +57,14 @@ ComInterface* ComManager::createInterface(std::string interface_name, InterfaceT
     return nullptr;
 #endif
 
+  case InterfaceType::SIMULATED:
+    _interfaces.emplace_back(std::make_unique<SimulatedInterface>(interface_name, bus_params.simulation));
+    break;
+
+  case InterfaceType::REPLAY:
+    _interfaces.emplace_back(std::make_unique<ReplayInterface>(interface_name, bus_params.replay));
+    break;
+
   case InterfaceType::UNDEFINED:
     logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Got an undefined interface type. Trying to open a the interface by its name.");
     try {
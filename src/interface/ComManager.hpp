@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "sensorring/Parameter.hpp"
 #include "sensorring/types/InterfaceType.hpp"
 #include "types/SingletonTemplate.hpp"
 
@@ -18,7 +19,7 @@ class ComManager : public Singleton<ComManager> {
   ComManager(const ComManager&)            = delete;
   ComManager& operator=(const ComManager&) = delete;
 
-  ComInterface* createInterface(std::string interface_name, InterfaceType type);
+  ComInterface* createInterface(const bus::BusParams& bus_params);
   ComInterface* getInterface(std::string interface_name);
 
 private:
@@ -4,7 +4,8 @@ namespace eduart {
 
 namespace com {
 
-ComObserver::ComObserver() {
+ComObserver::ComObserver()
+    : _rx_timestamp_ns(0) {
 }
 
 ComObserver::~ComObserver() {
@@ -30,17 +31,17 @@ const std::set<ComEndpoint>& ComObserver::getEndpoints() const {
   return _endpoints;
 }
 
-void ComObserver::forwardNotification(const ComEndpoint source, const std::vector<uint8_t>& data) {
-  for (const auto& endpoint : _endpoints) {
-    if (endpoint == source) {
-      // Take time stamp
-      _timestamp = std::chrono::steady_clock::now();
+void ComObserver::forwardNotification(const ComEndpoint& source, ByteSpan data, std::uint64_t rx_timestamp_ns) {
+  // Take time stamp
+  _timestamp       = std::chrono::steady_clock::now();
+  _rx_timestamp_ns = rx_timestamp_ns;
 
-      // Trigger callback
-      notify(source, data);
-      break;
-    }
-  }
+  // Trigger callback
+  notify(source, data);
+}
+
+std::uint64_t ComObserver::getRxTimestamp() const {
+  return _rx_timestamp_ns;
 }
 
 bool ComObserver::checkConnectionStatus(unsigned int timeoutInMillis) {
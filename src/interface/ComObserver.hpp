@@ -1,10 +1,12 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <set>
 #include <vector>
 
 #include "ComEndpoints.hpp"
+#include "types/Span.hpp"
 
 namespace eduart {
 
@@ -57,23 +59,33 @@ class ComObserver {
   bool checkConnectionStatus(unsigned int timeoutInMillis = 100);
 
   /**
-   * Distribute new can frame to all registered observers
+   * Take the arrival time stamp and trigger the notify callback. The ComInterface only forwards messages from
+   * endpoints that the observer subscribed to. Endpoints must therefore be added before the observer is registered.
    * @param[in] source ComEndpoint that sent the message
    * @param[in] data Message payload
+   * @param[in] rx_timestamp_ns receive time of the message in nanoseconds since the epoch
    */
-  void forwardNotification(const ComEndpoint source, const std::vector<uint8_t>& data);
+  void forwardNotification(const ComEndpoint& source, ByteSpan data, std::uint64_t rx_timestamp_ns);
+
+  /**
+   * Get the receive time of the message that is currently being processed. Only valid inside the notify callback.
+   * @return receive time in nanoseconds since the epoch
+   */
+  std::uint64_t getRxTimestamp() const;
 
   /**
    * Interface declaration for implementation through inherited classes.
    * @param[in] source ComEndpoint that sent the message
    * @param[in] data Message payload
    */
-  virtual void notify(const ComEndpoint source, const std::vector<uint8_t>& data) = 0;
+  virtual void notify(const ComEndpoint& source, ByteSpan data) = 0;
 
 private:
   std::set<ComEndpoint> _endpoints;
 
   std::chrono::time_point<std::chrono::steady_clock> _timestamp;
+
+  std::uint64_t _rx_timestamp_ns;
 };
 
 } // namespace com
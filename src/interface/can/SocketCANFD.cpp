@@ -1,26 +1,57 @@
 #include "SocketCANFD.hpp"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <exception>
 #include <fcntl.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
 #include <net/if.h>
 #include <stdexcept>
 #include <string.h>
+#include <sys/epoll.h>
 #include <sys/ioctl.h>
-#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include "interface/ComEndpoints.hpp"
+#include "logger/LogMacros.hpp"
 #include "sensorring/logger/Logger.hpp"
+#include "utils/Profiling.hpp"
+#include "utils/Clock.hpp"
 
 namespace eduart {
 
 namespace com {
 
+namespace {
+
+// Software receive time stamp of the kernel, zero if the message carries none
+std::uint64_t kernelRxTimestamp(msghdr& hdr) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPING) {
+      scm_timestamping timestamps;
+      memcpy(&timestamps, CMSG_DATA(cmsg), sizeof(timestamps));
+      return static_cast<std::uint64_t>(timestamps.ts[0].tv_sec) * 1000000000ULL + static_cast<std::uint64_t>(timestamps.ts[0].tv_nsec);
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
 SocketCANFD::SocketCANFD(std::string interface_name)
     : ComInterface()
-    , _soc(0) {
+    , _soc(0)
+    , _epoll_fd(-1)
+    , _tx_next_seq(0)
+    , _tx_done_seq(0)
+    , _tx_failed_from(0)
+    , _tx_failed_to(0)
+    , _next_tx_time(std::chrono::steady_clock::now())
+    , _shut_down_transmitter(false) {
 
   try {
     openInterface(interface_name);
@@ -31,10 +62,13 @@ SocketCANFD::SocketCANFD(std::string interface_name)
 
   _endpoints = ComEndpoint::createStaticEndpoints();
   fillEndpointMap();
+  updateDispatchTable();
   startListener();
+  startTransmitter();
 }
 
 SocketCANFD::~SocketCANFD() {
+  stopTransmitter();
   stopListener();
   closeInterface();
 }
@@ -69,6 +103,13 @@ bool SocketCANFD::openInterface(std::string interface_name) {
     throw std::runtime_error("CAN interface \"" + interface_name + "\" is UP but not RUNNING (no carrier)");
   }
 
+  // Let the kernel stamp received frames, which excludes the wake-up latency of the listener. Without time stamps the
+  // listener falls back to the time of the receive call.
+  int timestamping = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+  if (setsockopt(_soc, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping)) < 0) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Unable to enable receive time stamps on interface " + interface_name + ": " + std::string(strerror(errno)));
+  }
+
   // Get interface index
   if (ioctl(_soc, SIOCGIFINDEX, &ifr) < 0) {
     throw std::runtime_error("Unable to get interface index");
@@ -81,6 +122,19 @@ bool SocketCANFD::openInterface(std::string interface_name) {
     throw std::runtime_error("Unable to bind socket: " + std::string(strerror(errno)) + " [" + std::to_string(errno) + "]");
   }
 
+  // The listener sleeps in epoll_wait until frames arrive on the socket
+  _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (_epoll_fd < 0) {
+    throw std::runtime_error("Unable to create epoll instance: " + std::string(strerror(errno)) + " [" + std::to_string(errno) + "]");
+  }
+
+  epoll_event event{};
+  event.events  = EPOLLIN;
+  event.data.fd = _soc;
+  if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _soc, &event) < 0) {
+    throw std::runtime_error("Unable to register socket with epoll: " + std::string(strerror(errno)) + " [" + std::to_string(errno) + "]");
+  }
+
   _interface_name      = interface_name;
   _communication_error = false;
   return true;
@@ -89,18 +143,19 @@ bool SocketCANFD::openInterface(std::string interface_name) {
 bool SocketCANFD::send(ComEndpoint target, const std::vector<uint8_t>& data) {
 
   canid_t id = mapEndpointToId(target);
+  recordTx(id, data);
   return send(id, data);
 }
 
 bool SocketCANFD::send(canid_t canid, const std::vector<uint8_t>& tx_buf) {
 
   if (tx_buf.size() <= CANFD_MAX_DLEN) {
-    auto frame    = std::make_unique<canfd_frame>();
-    frame->can_id = canid;
-    frame->len    = tx_buf.size();
+    canfd_frame frame{};
+    frame.can_id = canid;
+    frame.len    = tx_buf.size();
 
-    std::copy_n(tx_buf.begin(), tx_buf.size(), frame->data);
-    return send(frame.get());
+    std::copy_n(tx_buf.begin(), tx_buf.size(), frame.data);
+    return send(&frame);
   }
 
   return false;
@@ -108,71 +163,223 @@ bool SocketCANFD::send(canid_t canid, const std::vector<uint8_t>& tx_buf) {
 
 bool SocketCANFD::send(const canfd_frame* frame) {
   if (frame) {
-    static double _timeCom = 0.0;
-    timeval clock;
-    double now = 0.0;
-    do {
-      ::gettimeofday(&clock, 0);
-      now = static_cast<double>(clock.tv_sec) + static_cast<double>(clock.tv_usec) * 1.0e-6;
-    } while ((now - _timeCom) < 0.002);
-    _timeCom = now;
-
-    int retval;
+    std::unique_lock<std::mutex> lock(_tx_mutex);
 
-    {
-      LockGuard guard(_mutex);
-      retval = write(_soc, frame, sizeof(canfd_frame));
+    if (_communication_error) {
+      throw std::runtime_error(_tx_error.empty() ? "CAN interface " + _interface_name + " is in an error state" : _tx_error);
     }
 
-    if (retval != sizeof(canfd_frame)) {
-      _communication_error = true;
-      throw std::runtime_error("CAN transmission error for command " + std::to_string((int)(frame->data[0])) + ", returned " + std::to_string(retval) + " submitted bytes instead of " + std::to_string(sizeof(canfd_frame)));
+    if (_shut_down_transmitter) {
       return false;
     }
 
-    _communication_error = false;
+    const auto seq = _tx_next_seq++;
+    _tx_queue.push_back(TxRequest{ *frame, seq });
+    _tx_cv.notify_one();
+
+    // the transmit thread reports the result of every frame, so a failure is raised by the command that caused it
+    _tx_done_cv.wait(lock, [this, seq]() { return _tx_done_seq > seq; });
+    if (seq >= _tx_failed_from && seq < _tx_failed_to) {
+      throw std::runtime_error(_tx_error.empty() ? "CAN frame was discarded on interface " + _interface_name : _tx_error);
+    }
     return true;
   }
   return false;
 }
 
+void SocketCANFD::startTransmitter() {
+  {
+    LockGuard guard(_tx_mutex);
+    _shut_down_transmitter = false;
+    _next_tx_time          = std::chrono::steady_clock::now();
+  }
+  _tx_thread = std::thread(&SocketCANFD::transmitter, this);
+}
+
+void SocketCANFD::stopTransmitter() {
+  {
+    LockGuard guard(_tx_mutex);
+    _shut_down_transmitter = true;
+  }
+  _tx_cv.notify_all();
+
+  if (_tx_thread.joinable()) {
+    _tx_thread.join();
+  }
+}
+
+void SocketCANFD::transmitter() {
+  std::array<canfd_frame, TX_BATCH_SIZE> batch;
+  std::unique_lock<std::mutex> lock(_tx_mutex);
+
+  while (true) {
+    _tx_cv.wait(lock, [this]() { return _shut_down_transmitter || !_tx_queue.empty(); });
+
+    // remaining frames are flushed on shut down
+    if (_tx_queue.empty()) {
+      break;
+    }
+
+    const auto gap          = _tx_frame_gap.load();
+    std::size_t count       = 0;
+    std::uint64_t first_seq = 0;
+
+    if (gap.count() > 0 && !_shut_down_transmitter) {
+      // sleep until the inter-frame gap to the previous frame has passed
+      if (_tx_cv.wait_until(lock, _next_tx_time, [this]() { return _shut_down_transmitter; })) {
+        continue;
+      }
+
+      // the queue is cleared when the interface is repaired
+      if (_tx_queue.empty()) {
+        continue;
+      }
+
+      first_seq      = _tx_queue.front().seq;
+      batch[count++] = _tx_queue.front().frame;
+      _tx_queue.pop_front();
+    } else {
+      // no gap required, send all queued frames with one system call
+      first_seq = _tx_queue.front().seq;
+      while (!_tx_queue.empty() && count < TX_BATCH_SIZE) {
+        batch[count++] = _tx_queue.front().frame;
+        _tx_queue.pop_front();
+      }
+    }
+
+    std::string error;
+    lock.unlock();
+    const auto sent = transmit(batch.data(), count, error);
+    lock.lock();
+
+    if (sent < count) {
+      // the failed frame and all frames queued after it are discarded and reported to their senders
+      _tx_error            = error;
+      _tx_failed_from      = first_seq + sent;
+      _tx_failed_to        = _tx_next_seq;
+      _tx_done_seq         = _tx_next_seq;
+      _communication_error = true;
+      _tx_queue.clear();
+    } else {
+      _tx_done_seq = first_seq + count;
+    }
+    _tx_done_cv.notify_all();
+
+    _next_tx_time = std::chrono::steady_clock::now() + gap;
+  }
+}
+
+std::size_t SocketCANFD::transmit(const canfd_frame* frames, std::size_t count, std::string& error) {
+  // The send mutex protects the socket against being closed by a concurrent repair
+  LockGuard guard(_mutex);
+
+  int retval         = 0;
+  std::size_t offset = 0;
+
+  if (count == 1) {
+    retval = write(_soc, frames, sizeof(canfd_frame));
+    offset = (retval == sizeof(canfd_frame)) ? 1 : 0;
+  } else {
+    std::array<iovec, TX_BATCH_SIZE> iovecs;
+    std::array<mmsghdr, TX_BATCH_SIZE> msgs;
+    for (std::size_t i = 0; i < count; i++) {
+      iovecs[i].iov_base         = const_cast<canfd_frame*>(&frames[i]);
+      iovecs[i].iov_len          = sizeof(canfd_frame);
+      msgs[i]                    = mmsghdr{};
+      msgs[i].msg_hdr.msg_iov    = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (offset < count) {
+      retval = sendmmsg(_soc, msgs.data() + offset, count - offset, 0);
+      if (retval <= 0) {
+        break;
+      }
+      offset += retval;
+    }
+  }
+
+  if (offset < count) {
+    error = "CAN transmission error for command " + std::to_string((int)(frames[offset].data[0])) + ", returned " + std::to_string(retval) + " instead of " + (count == 1 ? std::to_string(sizeof(canfd_frame)) + " submitted bytes" : std::to_string(count - offset) + " submitted frames");
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, error + " on interface " + _interface_name);
+  }
+
+  return offset;
+}
+
 bool SocketCANFD::listener() {
+  PROFILE_THREAD(("sensorring rx " + _interface_name).c_str());
   _shut_down_listener = false;
 
-  canfd_frame frame_rd;
-  int recvbytes = 0;
-
-  timeval timeout = { 0, 100 };
-  fd_set readSet;
+  // Receive buffers for batched reads. A burst of data frames is drained with a single recvmmsg call per batch.
+  std::array<canfd_frame, RX_BATCH_SIZE> frames;
+  std::array<iovec, RX_BATCH_SIZE> iovecs;
+  std::array<mmsghdr, RX_BATCH_SIZE> msgs;
+  std::array<RxControlBuffer, RX_BATCH_SIZE> controls;
+  for (std::size_t i = 0; i < RX_BATCH_SIZE; i++) {
+    iovecs[i].iov_base          = &frames[i];
+    iovecs[i].iov_len           = sizeof(canfd_frame);
+    msgs[i]                     = mmsghdr{};
+    msgs[i].msg_hdr.msg_iov     = &iovecs[i];
+    msgs[i].msg_hdr.msg_iovlen  = 1;
+    msgs[i].msg_hdr.msg_control = controls[i].data;
+  }
 
   logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Starting can listener on interface " + _interface_name);
 
+  bool receive_failed  = false;
   _listener_is_running = true;
-  while (!_shut_down_listener) {
-    FD_ZERO(&readSet);
+  while (!_shut_down_listener && !receive_failed) {
+    // Block until frames are available. The timeout only bounds the reaction time to a shutdown request.
+    epoll_event event;
+    if (epoll_wait(_epoll_fd, &event, 1, RX_TIMEOUT_MS) <= 0) {
+      continue;
+    }
 
-    {
-      LockGuard guard(_mutex);
-      FD_SET(_soc, &readSet);
-      if (select((_soc + 1), &readSet, NULL, NULL, &timeout) >= 0) {
-        if (FD_ISSET(_soc, &readSet)) {
-          recvbytes = read(_soc, &frame_rd, sizeof(canfd_frame));
-          if (recvbytes) {
-            try {
-              auto endpoint = mapIdToEndpoint(frame_rd.can_id);
-              for (const auto& observer : _observers) {
-                if (observer)
-                  observer->forwardNotification(endpoint, std::vector<std::uint8_t>(frame_rd.data, frame_rd.data + frame_rd.len));
-              }
-            } catch (const std::exception&) {
-              logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Tried to map unknown CAN ID on interface " + _interface_name);
-            }
-          }
+    int received = 0;
+    do {
+      // the kernel shrinks the control length to the received ancillary data
+      for (auto& msg : msgs) {
+        msg.msg_hdr.msg_controllen = sizeof(RxControlBuffer::data);
+      }
+
+      received                        = recvmmsg(_soc, msgs.data(), RX_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+      const std::uint64_t receive_time = utils::systemTimeNs();
+      if (received < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+          // The socket stays readable after e.g. ENETDOWN or ENODEV, retrying would spin on the level-triggered epoll.
+          // Leave the listener and let repairInterface() reopen the socket.
+          logger::Logger::getInstance()->log(logger::LogVerbosity::Error, "CAN receive error on interface " + _interface_name + ": " + std::string(strerror(errno)));
+          _communication_error = true;
+          receive_failed       = true;
         }
+        break;
       }
-    }
 
-    std::this_thread::sleep_for(std::chrono::microseconds(1));
+      PROFILE_ZONE("dispatch CAN frames");
+      PROFILE_COUNT_CAN_FRAMES(received);
+
+      // Dispatch views into the receive buffers without copying and without holding the send mutex
+      for (int i = 0; i < received; i++) {
+        const auto& frame = frames[i];
+        if (msgs[i].msg_len == 0) {
+          continue;
+        }
+
+        std::uint64_t rx_timestamp_ns = kernelRxTimestamp(msgs[i].msg_hdr);
+        if (rx_timestamp_ns == 0) {
+          rx_timestamp_ns = receive_time;
+        }
+
+        try {
+          if (!notifyObservers(frame.can_id, ByteSpan(frame.data, frame.len), rx_timestamp_ns)) {
+            LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Tried to map unknown CAN ID on interface " + _interface_name);
+          }
+        } catch (const std::exception& e) {
+          LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Error while processing a CAN frame on interface " + _interface_name + ": " + e.what());
+        }
+      }
+    } while (received == static_cast<int>(RX_BATCH_SIZE));
   }
   logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Stopping can listener on interface " + _interface_name);
 
@@ -181,6 +388,11 @@ bool SocketCANFD::listener() {
 }
 
 bool SocketCANFD::closeInterface() {
+  if (_epoll_fd >= 0) {
+    close(_epoll_fd);
+    _epoll_fd = -1;
+  }
+
   bool retval = false;
   if (_soc) {
     retval = (close(_soc) == 0);
@@ -190,13 +402,31 @@ bool SocketCANFD::closeInterface() {
 
 bool SocketCANFD::repairInterface() {
   stopListener();
-  closeInterface();
 
-  if (openInterface(_interface_name)) {
-    if (startListener())
-      return true;
+  {
+    // the transmitter must not write to the socket while it is reopened
+    LockGuard guard(_mutex);
+    closeInterface();
+
+    {
+      // frames that are still queued are reported as failed to their senders
+      LockGuard tx_guard(_tx_mutex);
+      if (!_tx_queue.empty()) {
+        _tx_failed_from = _tx_queue.front().seq;
+        _tx_failed_to   = _tx_next_seq;
+        _tx_queue.clear();
+      }
+      _tx_done_seq = _tx_next_seq;
+      _tx_error.clear();
+      _tx_done_cv.notify_all();
+    }
+
+    if (!openInterface(_interface_name)) {
+      return false;
+    }
   }
-  return false;
+
+  return startListener();
 }
 
 void SocketCANFD::fillEndpointMap() {
@@ -228,6 +458,7 @@ void SocketCANFD::addToFSensorToEndpointMap(std::size_t idx) {
   auto value                  = "tof" + std::to_string(idx) + "_data";
   _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(canid_tof_data_in + idx);
   _endpoints.emplace(value);
+  updateDispatchTable();
 }
 
 void SocketCANFD::addThermalSensorToEndpointMap(std::size_t idx) {
@@ -241,23 +472,11 @@ void SocketCANFD::addThermalSensorToEndpointMap(std::size_t idx) {
   auto value                  = "thermal" + std::to_string(idx) + "_data";
   _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(canid_thermal_data_in + idx);
   _endpoints.emplace(value);
+  updateDispatchTable();
 }
 
-CanProtocol::canid SocketCANFD::mapEndpointToId(ComEndpoint endpoint) {
-  canid_t id = _id_map.at(endpoint); // may throw out_of_range exception
-  return id;
-}
-
-ComEndpoint SocketCANFD::mapIdToEndpoint(CanProtocol::canid id) {
-  auto it = std::find_if(_id_map.begin(), _id_map.end(), [&id](const auto& pair) {
-    return pair.second == id;
-  });
-
-  if (it != _id_map.end()) {
-    return it->first;
-  } else {
-    throw std::runtime_error("No Endpoint found for given CAN ID");
-  }
+std::uint32_t SocketCANFD::mapEndpointToId(const ComEndpoint& endpoint) const {
+  return _id_map.at(endpoint); // may throw out_of_range exception
 }
 
 } // namespace com
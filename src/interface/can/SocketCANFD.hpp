@@ -1,9 +1,18 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/errqueue.h>
 #include <map>
+#include <mutex>
 #include <string>
+#include <sys/socket.h>
+#include <thread>
 #include <vector>
 
 #include "interface/ComInterface.hpp"
@@ -57,7 +66,9 @@ class SocketCANFD : public ComInterface {
   bool send(canid_t canid, const std::vector<uint8_t>& tx_buf);
 
   /**
-   * Send CAN frame.
+   * Queue a CAN frame for transmission and wait until it was sent. The frame is sent by the transmit thread as soon as
+   * the minimal inter-frame gap to the previous frame has passed, frames of concurrent callers are sent in one batch.
+   * Throws if the transmission of this frame failed or the interface is in an error state.
    * @param[in] frame CAN frame.
    * @return success==true
    */
@@ -87,18 +98,69 @@ class SocketCANFD : public ComInterface {
    */
   void addThermalSensorToEndpointMap(std::size_t idx) override;
 
+protected:
+  std::uint32_t mapEndpointToId(const ComEndpoint& endpoint) const override;
+
 private:
   void fillEndpointMap();
 
-  CanProtocol::canid mapEndpointToId(ComEndpoint endpoint);
-
-  ComEndpoint mapIdToEndpoint(CanProtocol::canid id);
-
   std::map<ComEndpoint, CanProtocol::canid> _id_map;
 
   bool listener() override;
 
+  void transmitter();
+
+  std::size_t transmit(const canfd_frame* frames, std::size_t count, std::string& error);
+
+  void startTransmitter();
+
+  void stopTransmitter();
+
+  static constexpr std::size_t RX_BATCH_SIZE = 64;
+
+  static constexpr std::size_t TX_BATCH_SIZE = 64;
+
+  static constexpr int RX_TIMEOUT_MS = 10;
+
+  // queued frame with the sequence number that identifies its transmission result
+  struct TxRequest {
+    canfd_frame frame;
+    std::uint64_t seq;
+  };
+
+  // ancillary data of a received frame, holds the kernel time stamps
+  struct RxControlBuffer {
+    alignas(cmsghdr) char data[CMSG_SPACE(sizeof(scm_timestamping))];
+  };
+
   int _soc;
+
+  int _epoll_fd;
+
+  std::mutex _tx_mutex;
+
+  std::condition_variable _tx_cv;
+
+  std::condition_variable _tx_done_cv;
+
+  std::deque<TxRequest> _tx_queue;
+
+  // Frames with a sequence number below _tx_done_seq were processed, the ones in [_tx_failed_from, _tx_failed_to) failed
+  std::uint64_t _tx_next_seq;
+
+  std::uint64_t _tx_done_seq;
+
+  std::uint64_t _tx_failed_from;
+
+  std::uint64_t _tx_failed_to;
+
+  std::chrono::time_point<std::chrono::steady_clock> _next_tx_time;
+
+  std::string _tx_error;
+
+  bool _shut_down_transmitter;
+
+  std::thread _tx_thread;
 };
 
 } // namespace com
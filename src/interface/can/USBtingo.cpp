@@ -9,7 +9,10 @@
 #include <usbtingo/can/Dlc.hpp>
 #include <usbtingo/device/DeviceFactory.hpp>
 
+#include "logger/LogMacros.hpp"
 #include "sensorring/logger/Logger.hpp"
+#include "utils/Clock.hpp"
+#include "utils/Profiling.hpp"
 
 #include "canprotocol.hpp"
 
@@ -25,6 +28,7 @@ USBtingo::USBtingo(std::string interface_name)
 
   _endpoints = ComEndpoint::createStaticEndpoints();
   fillEndpointMap();
+  updateDispatchTable();
   startListener();
 }
 
@@ -73,7 +77,10 @@ bool USBtingo::openInterface(std::string interface_name) {
 }
 
 bool USBtingo::send(ComEndpoint target, const std::vector<uint8_t>& data) {
-  usbtingo::bus::Message msg(mapEndpointToId(target), data);
+  const auto id = mapEndpointToId(target);
+  recordTx(id, data);
+
+  usbtingo::bus::Message msg(id, data);
   if (!_dev->send_can(msg.to_CanTxFrame(true))) {
     _communication_error = true;
     throw std::runtime_error("Unable to send message on interface " + _interface_name);
@@ -89,45 +96,45 @@ bool USBtingo::listener() {
   }
 
   logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Starting listener on interface " + _interface_name);
+  PROFILE_THREAD(("sensorring rx " + _interface_name).c_str());
 
   std::vector<usbtingo::device::CanRxFrame> rx_frames;
   std::vector<usbtingo::device::TxEventFrame> tx_event_frames;
 
-  auto zero_timeout = std::chrono::microseconds(0);
-  auto can_future   = _dev->request_can_async();
+  // The timeout only bounds the reaction time to a shutdown request
+  auto rx_timeout = std::chrono::milliseconds(10);
+  auto can_future = _dev->request_can_async();
 
   _shut_down_listener  = false;
   _listener_is_running = true;
   while (!_shut_down_listener) {
-    {
-      LockGuard guard(_mutex);
-
-      // can message handling
-      if (can_future.valid() && can_future.wait_for(zero_timeout) == std::future_status::ready) {
-        if (can_future.get()) {
-          _dev->receive_can_async(rx_frames, tx_event_frames);
-
-          // forward can frames
-          for (const auto& rx_frame : rx_frames) {
-
-            try {
-              auto endpoint = mapIdToEndpoint(rx_frame.id);
-              for (auto observer : _observers) {
-                if (observer)
-                  observer->forwardNotification(endpoint, std::vector<std::uint8_t>(rx_frame.data.begin(), rx_frame.data.begin() + usbtingo::can::Dlc::dlc_to_bytes(rx_frame.dlc)));
-              }
-            } catch (const std::exception&) {
-              logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Tried to map unknown CAN ID on interface " + _interface_name);
+    // can message handling
+    if (can_future.valid() && can_future.wait_for(rx_timeout) == std::future_status::ready) {
+      if (can_future.get()) {
+        _dev->receive_can_async(rx_frames, tx_event_frames);
+
+        // The device time stamps run on the adapter clock, the whole batch is stamped with the host time instead
+        const std::uint64_t rx_timestamp_ns = utils::systemTimeNs();
+
+        PROFILE_ZONE("dispatch CAN frames");
+        PROFILE_COUNT_CAN_FRAMES(rx_frames.size());
+
+        // forward all received can frames without holding the send mutex
+        for (const auto& rx_frame : rx_frames) {
+
+          try {
+            if (!notifyObservers(rx_frame.id, ByteSpan(rx_frame.data.data(), usbtingo::can::Dlc::dlc_to_bytes(rx_frame.dlc)), rx_timestamp_ns)) {
+              LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Tried to map unknown CAN ID on interface " + _interface_name);
             }
+          } catch (const std::exception& e) {
+            LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Error while processing a CAN frame on interface " + _interface_name + ": " + e.what());
           }
-          rx_frames.clear();
-          tx_event_frames.clear();
         }
-        can_future = _dev->request_can_async();
+        rx_frames.clear();
+        tx_event_frames.clear();
       }
+      can_future = _dev->request_can_async();
     }
-
-    std::this_thread::sleep_for(std::chrono::microseconds(1));
   }
 
   logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Stopping can listener on interface " + _interface_name);
@@ -181,6 +188,7 @@ void USBtingo::addToFSensorToEndpointMap(std::size_t idx) {
   auto value                  = "tof" + std::to_string(idx) + "_data";
   _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(canid_tof_data_in + idx);
   _endpoints.emplace(value);
+  updateDispatchTable();
 }
 
 void USBtingo::addThermalSensorToEndpointMap(std::size_t idx) {
@@ -194,23 +202,11 @@ void USBtingo::addThermalSensorToEndpointMap(std::size_t idx) {
   auto value                  = "thermal" + std::to_string(idx) + "_data";
   _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(canid_thermal_data_in + idx);
   _endpoints.emplace(value);
+  updateDispatchTable();
 }
 
-CanProtocol::canid USBtingo::mapEndpointToId(ComEndpoint ep) {
-  CanProtocol::canid id = _id_map.at(ep); // may throw out_of_range exception
-  return id;
-}
-
-ComEndpoint USBtingo::mapIdToEndpoint(CanProtocol::canid id) {
-  auto it = std::find_if(_id_map.begin(), _id_map.end(), [&id](const auto& pair) {
-    return pair.second == id;
-  });
-
-  if (it != _id_map.end()) {
-    return it->first;
-  } else {
-    throw std::runtime_error("No Endpoint found for given CAN ID");
-  }
+std::uint32_t USBtingo::mapEndpointToId(const ComEndpoint& endpoint) const {
+  return _id_map.at(endpoint); // may throw out_of_range exception
 }
 
 } // namespace com
@@ -71,13 +71,12 @@ class USBtingo : public ComInterface {
    */
   void addThermalSensorToEndpointMap(std::size_t idx) override;
 
+protected:
+  std::uint32_t mapEndpointToId(const ComEndpoint& endpoint) const override;
+
 private:
   void fillEndpointMap();
 
-  CanProtocol::canid mapEndpointToId(ComEndpoint ep);
-
-  ComEndpoint mapIdToEndpoint(std::uint32_t id);
-
   std::map<ComEndpoint, std::uint32_t> _id_map;
 
   bool listener() override;
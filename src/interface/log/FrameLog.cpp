@@ -0,0 +1,44 @@
+#include "FrameLog.hpp"
+
+#include <cstring>
+
+namespace eduart {
+
+namespace com {
+
+namespace framelog {
+
+bool parse(const std::uint8_t* data, std::size_t size, std::vector<Frame>& frames) {
+  FileHeader file_header;
+  if (!data || size < sizeof(file_header)) {
+    return false;
+  }
+  std::memcpy(&file_header, data, sizeof(file_header));
+  if (std::memcmp(file_header.magic, MAGIC, sizeof(MAGIC)) != 0 || file_header.version != VERSION) {
+    return false;
+  }
+
+  frames.clear();
+  std::size_t offset = sizeof(file_header);
+  while (offset + sizeof(RecordHeader) <= size) {
+    RecordHeader header;
+    std::memcpy(&header, data + offset, sizeof(header));
+    offset += sizeof(header);
+
+    const auto direction = static_cast<Direction>(header.direction);
+    if ((direction != Direction::Rx && direction != Direction::Tx) || offset + header.length > size) {
+      break;
+    }
+
+    frames.push_back(Frame{ header.timestamp_ns, header.id, direction, ByteSpan(data + offset, header.length) });
+    offset += header.length;
+  }
+
+  return true;
+}
+
+} // namespace framelog
+
+} // namespace com
+
+} // namespace eduart
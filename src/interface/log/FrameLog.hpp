@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types/Span.hpp"
+
+namespace eduart {
+
+namespace com {
+
+/**
+ * Binary format of the frame logs. A log starts with the file header, followed by one record per frame. Each record
+ * consists of the record header and the payload of the frame without padding. All values are little endian. A record
+ * with the direction End, which also matches zero filled space, terminates the log.
+ */
+namespace framelog {
+
+static constexpr char MAGIC[8]        = { 'S', 'R', 'F', 'R', 'A', 'M', 'E', 'S' };
+static constexpr std::uint32_t VERSION = 1;
+
+/// Largest payload of a single frame
+static constexpr std::size_t MAX_PAYLOAD_LENGTH = 64;
+
+enum class Direction : std::uint8_t {
+  End = 0,
+  Rx  = 1,
+  Tx  = 2
+};
+
+struct FileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t reserved;
+};
+
+struct RecordHeader {
+  std::uint64_t timestamp_ns;
+  std::uint32_t id;
+  std::uint8_t direction;
+  std::uint8_t length;
+  std::uint16_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 16, "unexpected padding in the frame log file header");
+static_assert(sizeof(RecordHeader) == 16, "unexpected padding in the frame log record header");
+
+/**
+ * @struct Frame
+ * @brief One recorded frame. The payload points into the buffer of the log and is only valid as long as the buffer.
+ */
+struct Frame {
+  std::uint64_t timestamp_ns;
+  std::uint32_t id;
+  Direction direction;
+  ByteSpan payload;
+};
+
+/**
+ * Index all frames of a log without copying their payloads
+ * @param[in] data content of the log file, e.g. a memory-mapped file
+ * @param[in] size size of the content in bytes
+ * @param[out] frames frames in recording order
+ * @return true if the content is a valid frame log. A truncated last record is ignored.
+ */
+bool parse(const std::uint8_t* data, std::size_t size, std::vector<Frame>& frames);
+
+} // namespace framelog
+
+} // namespace com
+
+} // namespace eduart
@@ -0,0 +1,215 @@
+#include "FrameRecorder.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FRAME_RECORDER_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace eduart {
+
+namespace com {
+
+#ifdef FRAME_RECORDER_USE_MMAP
+namespace {
+
+// Extend the file by one segment and map it, the segments are added in order
+std::uint8_t* mapSegment(int fd, std::size_t idx, std::size_t segment_size) {
+  if (ftruncate(fd, static_cast<off_t>((idx + 1) * segment_size)) != 0) {
+    return nullptr;
+  }
+
+  void* map = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(idx * segment_size));
+  return (map == MAP_FAILED) ? nullptr : static_cast<std::uint8_t*>(map);
+}
+
+} // namespace
+#endif
+
+FrameRecorder::FrameRecorder()
+    : _frame_count(0)
+    , _offset(0)
+    , _fd(-1)
+    , _grow_failed(false)
+    , _shut_down(false)
+    , _file(nullptr) {
+}
+
+FrameRecorder::~FrameRecorder() {
+  close();
+}
+
+bool FrameRecorder::open(const std::string& filename) {
+  close();
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _frame_count = 0;
+  _offset      = 0;
+  _grow_failed = false;
+  _shut_down   = false;
+
+#ifdef FRAME_RECORDER_USE_MMAP
+  _fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (_fd < 0) {
+    return false;
+  }
+
+  // the first segments are mapped right away, later ones by the growth thread
+  for (std::size_t idx = 0; idx <= SPARE_SEGMENTS; idx++) {
+    auto* segment = mapSegment(_fd, idx, SEGMENT_SIZE);
+    if (!segment) {
+      lock.unlock();
+      close();
+      return false;
+    }
+    _segments.push_back(segment);
+  }
+  _growth_thread = std::thread(&FrameRecorder::growthWorker, this);
+#else
+  _file = std::fopen(filename.c_str(), "wb");
+  if (!_file) {
+    return false;
+  }
+#endif
+
+  framelog::FileHeader header{};
+  std::memcpy(header.magic, framelog::MAGIC, sizeof(header.magic));
+  header.version = framelog::VERSION;
+
+  if (!reserve(lock, sizeof(header))) {
+    lock.unlock();
+    close();
+    return false;
+  }
+  write(&header, sizeof(header));
+  return true;
+}
+
+void FrameRecorder::close() {
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _shut_down = true;
+  }
+  _grow_cv.notify_all();
+  if (_growth_thread.joinable()) {
+    _growth_thread.join();
+  }
+
+  std::lock_guard<std::mutex> guard(_mutex);
+#ifdef FRAME_RECORDER_USE_MMAP
+  for (auto* segment : _segments) {
+    munmap(segment, SEGMENT_SIZE);
+  }
+  _segments.clear();
+  if (_fd >= 0) {
+    // cut off the unused segments, if this fails the reader stops at the zero filled rest
+    if (ftruncate(_fd, static_cast<off_t>(_offset)) != 0) {
+      _offset = 0;
+    }
+    ::close(_fd);
+    _fd = -1;
+  }
+#else
+  if (_file) {
+    std::fclose(_file);
+    _file = nullptr;
+  }
+#endif
+}
+
+void FrameRecorder::record(framelog::Direction direction, std::uint32_t id, const std::uint8_t* data, std::size_t len, std::uint64_t timestamp_ns) {
+  len = std::min(len, framelog::MAX_PAYLOAD_LENGTH);
+
+  framelog::RecordHeader header{};
+  header.timestamp_ns = timestamp_ns;
+  header.id           = id;
+  header.direction    = static_cast<std::uint8_t>(direction);
+  header.length       = static_cast<std::uint8_t>(len);
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (!reserve(lock, sizeof(header) + len)) {
+    return;
+  }
+  write(&header, sizeof(header));
+  write(data, len);
+  _frame_count++;
+}
+
+std::size_t FrameRecorder::getFrameCount() const {
+  std::lock_guard<std::mutex> guard(_mutex);
+  return _frame_count;
+}
+
+void FrameRecorder::write(const void* data, std::size_t len) {
+#ifdef FRAME_RECORDER_USE_MMAP
+  // a record may cross the border of two segments
+  const auto* src = static_cast<const std::uint8_t*>(data);
+  while (len > 0) {
+    const std::size_t pos   = _offset % SEGMENT_SIZE;
+    const std::size_t chunk = std::min(len, SEGMENT_SIZE - pos);
+    std::memcpy(_segments[_offset / SEGMENT_SIZE] + pos, src, chunk);
+    src += chunk;
+    len -= chunk;
+    _offset += chunk;
+  }
+#else
+  std::fwrite(data, 1, len, _file);
+  _offset += len;
+#endif
+}
+
+bool FrameRecorder::reserve(std::unique_lock<std::mutex>& lock, std::size_t len) {
+#ifdef FRAME_RECORDER_USE_MMAP
+  if (_fd < 0) {
+    return false;
+  }
+
+  // hand the growth to the growth thread as soon as the last spare segment is entered
+  if (_segments.size() <= (_offset + len) / SEGMENT_SIZE + SPARE_SEGMENTS) {
+    _grow_cv.notify_all();
+  }
+
+  // only waits if the growth thread fell behind by a whole segment
+  _grow_cv.wait(lock, [this, len] { return _offset + len <= _segments.size() * SEGMENT_SIZE || _grow_failed || _shut_down; });
+  return _offset + len <= _segments.size() * SEGMENT_SIZE;
+#else
+  (void)lock;
+  (void)len;
+  return _file != nullptr;
+#endif
+}
+
+void FrameRecorder::growthWorker() {
+#ifdef FRAME_RECORDER_USE_MMAP
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _grow_cv.wait(lock, [this] { return _shut_down || _segments.size() <= _offset / SEGMENT_SIZE + SPARE_SEGMENTS; });
+    if (_shut_down) {
+      break;
+    }
+
+    // the file system calls run without the lock, the receiving threads keep writing into the mapped segments
+    const std::size_t idx = _segments.size();
+    const int fd          = _fd;
+    lock.unlock();
+    auto* segment = mapSegment(fd, idx, SEGMENT_SIZE);
+    lock.lock();
+
+    if (!segment) {
+      _grow_failed = true;
+      _grow_cv.notify_all();
+      break;
+    }
+    _segments.push_back(segment);
+    _grow_cv.notify_all();
+  }
+#endif
+}
+
+} // namespace com
+
+} // namespace eduart
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FrameLog.hpp"
+
+namespace eduart {
+
+namespace com {
+
+/**
+ * @class FrameRecorder
+ * @brief Append-only writer of frame logs. On POSIX systems the file is memory-mapped in large segments, so recording a
+ * frame is a copy into the mapping without a system call. The kernel writes the pages back in the background, which
+ * keeps the recorded frames even if the process crashes. A growth thread extends the file and maps the next segment
+ * while the current one is filled, so the receiving threads never wait for the file system and existing mappings are
+ * never moved. Other systems fall back to buffered file output.
+ */
+class FrameRecorder {
+public:
+  /**
+   * Constructor
+   */
+  FrameRecorder();
+
+  /**
+   * Destructor, closes the log file
+   */
+  ~FrameRecorder();
+
+  FrameRecorder(const FrameRecorder&)            = delete;
+  FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+  /**
+   * Create a new log file. An existing file is overwritten.
+   * @param[in] filename path of the log file
+   * @return success==true
+   */
+  bool open(const std::string& filename);
+
+  /**
+   * Truncate the log file to the recorded frames and close it
+   */
+  void close();
+
+  /**
+   * Append a frame to the log. Thread safe.
+   * @param[in] direction direction of the frame
+   * @param[in] id id of the frame on the bus
+   * @param[in] data payload of the frame, longer payloads are truncated
+   * @param[in] len payload length
+   * @param[in] timestamp_ns time stamp of the frame in nanoseconds since the epoch of the system clock
+   */
+  void record(framelog::Direction direction, std::uint32_t id, const std::uint8_t* data, std::size_t len, std::uint64_t timestamp_ns);
+
+  /**
+   * Get the number of recorded frames
+   * @return number of frames
+   */
+  std::size_t getFrameCount() const;
+
+private:
+  void write(const void* data, std::size_t len);
+
+  bool reserve(std::unique_lock<std::mutex>& lock, std::size_t len);
+
+  void growthWorker();
+
+  // Size of a mapped segment. The file is sparse, so unused segments take no disk space.
+  static constexpr std::size_t SEGMENT_SIZE = 64 * 1024 * 1024;
+
+  // Number of mapped segments that are kept ahead of the write position
+  static constexpr std::size_t SPARE_SEGMENTS = 1;
+
+  mutable std::mutex _mutex;
+
+  std::condition_variable _grow_cv;
+
+  std::size_t _frame_count;
+
+  std::size_t _offset;
+
+  int _fd;
+
+  // Mapping of every segment of the file, segment i starts at the file offset i * SEGMENT_SIZE
+  std::vector<std::uint8_t*> _segments;
+
+  bool _grow_failed;
+
+  bool _shut_down;
+
+  std::thread _growth_thread;
+
+  std::FILE* _file;
+};
+
+} // namespace com
+
+} // namespace eduart
@@ -0,0 +1,228 @@
+#include "ReplayInterface.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include "interface/ComEndpoints.hpp"
+#include "logger/LogMacros.hpp"
+#include "sensorring/logger/Logger.hpp"
+#include "utils/Profiling.hpp"
+
+namespace eduart {
+
+namespace com {
+
+ReplayInterface::ReplayInterface(std::string interface_name, bus::ReplayParams params)
+    : ComInterface()
+    , _params(params)
+    , _canid_tof_data(0)
+    , _canid_thermal_data(0)
+    , _canid_tof_request(0)
+    , _canid_thermal_request(0)
+    , _canid_broadcast(0)
+    , _end_of_log(false) {
+
+  _endpoints = ComEndpoint::createStaticEndpoints();
+  fillEndpointMap();
+  updateDispatchTable();
+
+  try {
+    openInterface(interface_name);
+  } catch (std::runtime_error& e) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Exception, "Unable to open interface " + _interface_name + ": " + e.what());
+  }
+
+  startListener();
+}
+
+ReplayInterface::~ReplayInterface() {
+  stopListener();
+  closeInterface();
+}
+
+bool ReplayInterface::openInterface(std::string interface_name) {
+  _interface_name = interface_name;
+
+  LockGuard guard(_replay_mutex);
+  _pending = {};
+  _frames.clear();
+  if (!_log.open(_params.log_file) || !framelog::parse(_log.data(), _log.size(), _frames)) {
+    throw std::runtime_error("Unable to read the frame log \"" + _params.log_file + "\"");
+  }
+
+  _end_of_log = false;
+
+  assignResponses();
+
+  // frames that were received before the first command are released right away
+  if (!_frames.empty()) {
+    releaseResponses(NO_COMMAND, _frames.front().timestamp_ns);
+  }
+
+  _communication_error = false;
+  return true;
+}
+
+bool ReplayInterface::closeInterface() {
+  LockGuard guard(_replay_mutex);
+  _pending = {};
+  return true;
+}
+
+bool ReplayInterface::repairInterface() {
+  stopListener();
+  closeInterface();
+  return startListener();
+}
+
+bool ReplayInterface::send(ComEndpoint target, const std::vector<uint8_t>& data) {
+  const auto id = mapEndpointToId(target); // may throw out_of_range exception
+  recordTx(id, data);
+
+  LockGuard guard(_replay_mutex);
+  auto it = _commands.find({ id, data });
+  if (it == _commands.end() || it->second.empty()) {
+    if (!_end_of_log) {
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "No recorded occurrence of a command left in the frame log of interface " + _interface_name);
+      _end_of_log = true;
+    }
+    return true;
+  }
+
+  const auto idx = it->second.front();
+  it->second.pop_front();
+  releaseResponses(idx, _frames[idx].timestamp_ns);
+  return true;
+}
+
+void ReplayInterface::assignResponses() {
+  _commands.clear();
+  _responses.clear();
+
+  std::map<CanProtocol::canid, std::size_t> latest_command;
+  for (std::size_t idx = 0; idx < _frames.size(); idx++) {
+    const auto& frame = _frames[idx];
+    if (frame.direction == framelog::Direction::Tx) {
+      _commands[{ frame.id, std::vector<std::uint8_t>(frame.payload.begin(), frame.payload.end()) }].push_back(idx);
+      latest_command[frame.id] = idx;
+    } else {
+      const auto it = latest_command.find(mapResponseToCommand(frame.id));
+      _responses[(it != latest_command.end()) ? it->second : NO_COMMAND].push_back(idx);
+    }
+  }
+}
+
+CanProtocol::canid ReplayInterface::mapResponseToCommand(std::uint32_t id) const {
+  if (id >= _canid_tof_data && id < _canid_tof_data + MAX_BOARD_COUNT) {
+    return _canid_tof_request;
+  }
+  if (id >= _canid_thermal_data && id < _canid_thermal_data + MAX_BOARD_COUNT) {
+    return _canid_thermal_request;
+  }
+  return _canid_broadcast;
+}
+
+void ReplayInterface::releaseResponses(std::size_t command_idx, std::uint64_t anchor_timestamp_ns) {
+  const auto it = _responses.find(command_idx);
+  if (it == _responses.end()) {
+    return;
+  }
+
+  const auto now = Clock::now();
+  for (const auto idx : it->second) {
+    auto time = now;
+    if (_params.real_time && _frames[idx].timestamp_ns > anchor_timestamp_ns) {
+      time += std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(_frames[idx].timestamp_ns - anchor_timestamp_ns));
+    }
+    _pending.push(PendingFrame{ time, idx });
+  }
+  _responses.erase(it);
+
+  _replay_cv.notify_one();
+}
+
+bool ReplayInterface::listener() {
+  PROFILE_THREAD(("sensorring rx " + _interface_name).c_str());
+  _shut_down_listener = false;
+
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Starting replay listener on interface " + _interface_name);
+
+  std::unique_lock<std::mutex> lock(_replay_mutex);
+  _listener_is_running = true;
+  while (!_shut_down_listener) {
+    // The timeout only bounds the reaction time to a shutdown request
+    const auto timeout = Clock::now() + RX_TIMEOUT;
+    if (_pending.empty() || _pending.top().time > Clock::now()) {
+      _replay_cv.wait_until(lock, _pending.empty() ? timeout : std::min(timeout, _pending.top().time));
+      continue;
+    }
+
+    // the log is not modified while the listener runs, so the frame can be used without the lock
+    const auto& frame = _frames[_pending.top().idx];
+    _pending.pop();
+
+    lock.unlock();
+    PROFILE_COUNT_CAN_FRAMES(1);
+    try {
+      if (!notifyObservers(frame.id, frame.payload, frame.timestamp_ns)) {
+        LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Tried to map unknown CAN ID on interface " + _interface_name);
+      }
+    } catch (const std::exception& e) {
+      LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Error while processing a CAN frame on interface " + _interface_name + ": " + e.what());
+    }
+    lock.lock();
+  }
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Stopping replay listener on interface " + _interface_name);
+
+  _listener_is_running = false;
+  return true;
+}
+
+void ReplayInterface::fillEndpointMap() {
+  CanProtocol::canid canid_tof_status, canid_tof_request, canid_broadcast;
+  CanProtocol::makeCanStdID(SYSID_TOF, NODEID_TOF_STATUS, canid_tof_status, canid_tof_request, canid_broadcast);
+
+  CanProtocol::canid canid_thermal_status, canid_thermal_request, canid_thermal_broadcast;
+  CanProtocol::makeCanStdID(SYSID_THERMAL, NODEID_THERMAL_STATUS, canid_thermal_status, canid_thermal_request, canid_thermal_broadcast);
+
+  CanProtocol::canid canid_light_in, canid_light_out, canid_light;
+  CanProtocol::makeCanStdID(SYSID_LIGHT, NODEID_HEADLEFT, canid_light_in, canid_light_out, canid_light);
+
+  CanProtocol::canid canid_tof_data_out, canid_thermal_data_out;
+  CanProtocol::makeCanStdID(SYSID_TOF, NODEID_TOF_DATA, _canid_tof_data, canid_tof_data_out, canid_broadcast);
+  CanProtocol::makeCanStdID(SYSID_THERMAL, NODEID_THERMAL_DATA, _canid_thermal_data, canid_thermal_data_out, canid_thermal_broadcast);
+
+  _canid_tof_request     = canid_tof_request;
+  _canid_thermal_request = canid_thermal_request;
+  _canid_broadcast       = canid_broadcast;
+
+  _id_map[ComEndpoint("tof_status")]      = canid_tof_status;
+  _id_map[ComEndpoint("tof_request")]     = canid_tof_request;
+  _id_map[ComEndpoint("thermal_status")]  = canid_thermal_status;
+  _id_map[ComEndpoint("thermal_request")] = canid_thermal_request;
+  _id_map[ComEndpoint("light")]           = canid_light;
+  _id_map[ComEndpoint("broadcast")]       = canid_broadcast;
+}
+
+void ReplayInterface::addToFSensorToEndpointMap(std::size_t idx) {
+  auto value                  = "tof" + std::to_string(idx) + "_data";
+  _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(_canid_tof_data + idx);
+  _endpoints.emplace(value);
+  updateDispatchTable();
+}
+
+void ReplayInterface::addThermalSensorToEndpointMap(std::size_t idx) {
+  auto value                  = "thermal" + std::to_string(idx) + "_data";
+  _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(_canid_thermal_data + idx);
+  _endpoints.emplace(value);
+  updateDispatchTable();
+}
+
+std::uint32_t ReplayInterface::mapEndpointToId(const ComEndpoint& endpoint) const {
+  return _id_map.at(endpoint); // may throw out_of_range exception
+}
+
+} // namespace com
+
+} // namespace eduart
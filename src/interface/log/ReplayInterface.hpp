@@ -0,0 +1,162 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "interface/ComInterface.hpp"
+#include "interface/can/canprotocol.hpp"
+#include "sensorring/Parameter.hpp"
+#include "utils/MappedFile.hpp"
+
+#include "FrameLog.hpp"
+
+namespace eduart {
+
+namespace com {
+
+/**
+ * @class ReplayInterface
+ * @brief Communication interface that plays back a recorded frame log. Every received frame of the log belongs to the
+ * latest recorded command on its request channel: Time-of-Flight data to the latest ToF request, thermal data to the
+ * latest thermal request and all other frames to the latest broadcast. The responses of a command are released when the
+ * measurement pipeline sends the same command again, so the replay follows the state machine in the same way the sensor
+ * boards did. Every sent command releases the responses of the next unused occurrence of the command in the log, which
+ * allows independent commands to be sent in a different order than recorded. The frames are delivered with their
+ * recorded time stamps, either with the recorded timing or as fast as possible. The log is memory-mapped and the frames
+ * are delivered straight from the mapping.
+ */
+class ReplayInterface : public ComInterface {
+public:
+  /**
+   * Constructor
+   * @param[in] interface_name name of the interface
+   * @param[in] params log file and timing of the playback
+   */
+  ReplayInterface(std::string interface_name, bus::ReplayParams params);
+
+  /**
+   * Destructor
+   */
+  ~ReplayInterface();
+
+  /**
+   * Open the interface and load the log file. Must be called after the endpoint map is filled.
+   * @param[in] interface_name name of the interface
+   * @return success==true
+   */
+  bool openInterface(std::string interface_name) override;
+
+  /**
+   * Send a command. The command releases the recorded responses to the matching command of the log.
+   * @param[in] target ComEndpoint to which the message is sent.
+   * @param[in] data Message payload.
+   * @return success==true
+   */
+  bool send(ComEndpoint target, const std::vector<uint8_t>& data) override;
+
+  /**
+   * Close the interface.
+   * @return success==true
+   */
+  bool closeInterface() override;
+
+  /**
+   * Repair the connection in case of an error. Released frames that were not delivered yet are discarded.
+   * @return success==true
+   */
+  bool repairInterface() override;
+
+  /**
+   * Add endpoint for a new tof sensor
+   * @param[in] idx index of the sensor
+   */
+  void addToFSensorToEndpointMap(std::size_t idx) override;
+
+  /**
+   * Add endpoint for a new thermal sensor
+   * @param[in] idx index of the sensor
+   */
+  void addThermalSensorToEndpointMap(std::size_t idx) override;
+
+protected:
+  std::uint32_t mapEndpointToId(const ComEndpoint& endpoint) const override;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  // Received frame of the log that is delivered at the given time
+  struct PendingFrame {
+    Clock::time_point time;
+    std::size_t idx;
+  };
+
+  // Orders the pending frames by time and by their position in the log
+  struct PendingLater {
+    bool operator()(const PendingFrame& a, const PendingFrame& b) const {
+      return (a.time != b.time) ? (a.time > b.time) : (a.idx > b.idx);
+    }
+  };
+
+  void fillEndpointMap();
+
+  bool listener() override;
+
+  void assignResponses();
+
+  CanProtocol::canid mapResponseToCommand(std::uint32_t id) const;
+
+  void releaseResponses(std::size_t command_idx, std::uint64_t anchor_timestamp_ns);
+
+  // Highest number of sensor boards that can be selected in a command
+  static constexpr std::size_t MAX_BOARD_COUNT = 16;
+
+  // Key of the responses that were received before the first command
+  static constexpr std::size_t NO_COMMAND = static_cast<std::size_t>(-1);
+
+  static constexpr std::chrono::milliseconds RX_TIMEOUT = std::chrono::milliseconds(10);
+
+  bus::ReplayParams _params;
+
+  std::map<ComEndpoint, CanProtocol::canid> _id_map;
+
+  CanProtocol::canid _canid_tof_data;
+
+  CanProtocol::canid _canid_thermal_data;
+
+  CanProtocol::canid _canid_tof_request;
+
+  CanProtocol::canid _canid_thermal_request;
+
+  CanProtocol::canid _canid_broadcast;
+
+  filemanager::MappedFile _log;
+
+  // Index of the frames of the log, the payloads point into the mapping
+  std::vector<framelog::Frame> _frames;
+
+  std::mutex _replay_mutex;
+
+  std::condition_variable _replay_cv;
+
+  std::priority_queue<PendingFrame, std::vector<PendingFrame>, PendingLater> _pending;
+
+  // Unused occurrences of every recorded command in the order of the log
+  std::map<std::pair<std::uint32_t, std::vector<std::uint8_t> >, std::deque<std::size_t> > _commands;
+
+  // Received frames of the log by the index of the command they belong to
+  std::map<std::size_t, std::vector<std::size_t> > _responses;
+
+  bool _end_of_log;
+};
+
+} // namespace com
+
+} // namespace eduart
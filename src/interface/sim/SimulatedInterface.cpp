@@ -0,0 +1,266 @@
+#include "SimulatedInterface.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "interface/ComEndpoints.hpp"
+#include "logger/LogMacros.hpp"
+#include "sensorring/logger/Logger.hpp"
+#include "utils/Clock.hpp"
+#include "utils/Profiling.hpp"
+
+namespace eduart {
+
+namespace com {
+
+SimulatedInterface::SimulatedInterface(std::string interface_name, bus::SimulationParams params)
+    : ComInterface()
+    , _params(params)
+    , _canid_broadcast(0)
+    , _canid_tof_data(0)
+    , _canid_thermal_data(0)
+    , _event_seq(0)
+    , _bus_free_at(Clock::now())
+    , _rng(params.seed) {
+
+  for (std::size_t idx = 0; idx < _params.board_count; idx++) {
+    _boards.emplace_back(idx, _params.seed);
+  }
+
+  openInterface(interface_name);
+
+  _endpoints = ComEndpoint::createStaticEndpoints();
+  fillEndpointMap();
+  updateDispatchTable();
+  startListener();
+}
+
+SimulatedInterface::~SimulatedInterface() {
+  stopListener();
+  closeInterface();
+}
+
+bool SimulatedInterface::openInterface(std::string interface_name) {
+  _interface_name      = interface_name;
+  _communication_error = false;
+  return true;
+}
+
+bool SimulatedInterface::closeInterface() {
+  LockGuard guard(_event_mutex);
+  _events = {};
+  return true;
+}
+
+bool SimulatedInterface::repairInterface() {
+  stopListener();
+  closeInterface();
+
+  if (!openInterface(_interface_name)) {
+    return false;
+  }
+
+  return startListener();
+}
+
+bool SimulatedInterface::send(ComEndpoint target, const std::vector<uint8_t>& data) {
+  const auto id = mapEndpointToId(target); // may throw out_of_range exception
+  recordTx(id, data);
+
+  LockGuard guard(_event_mutex);
+  if (id == _id_map.at(ComEndpoint("broadcast"))) {
+    handleBroadcast(data);
+  } else if (id == _id_map.at(ComEndpoint("tof_request"))) {
+    handleTofRequest(data);
+  } else if (id == _id_map.at(ComEndpoint("thermal_request"))) {
+    handleThermalRequest(data);
+  }
+
+  // commands to the lights have no response
+  return true;
+}
+
+void SimulatedInterface::handleBroadcast(const std::vector<uint8_t>& data) {
+  if (data.size() == 1 && data[0] == CMD_HARD_RESET) {
+    _events = {};
+    for (auto& board : _boards) {
+      board.reset();
+    }
+  } else if (data.size() == 2 && data[0] == CMD_ACTIVE_DEVICE_QUERY) {
+    // the enumeration is configuration traffic and is not affected by the fault injection
+    for (std::size_t idx = 0; idx < _boards.size(); idx++) {
+      scheduleTransmission(idx, _canid_broadcast, { _boards[idx].enumerationResponse() }, false);
+    }
+  }
+}
+
+void SimulatedInterface::handleTofRequest(const std::vector<uint8_t>& data) {
+  // the fetch command only consists of the board selection
+  if (data.size() == 2) {
+    for (const auto idx : selectBoards(data[0], data[1], true)) {
+      if (_boards[idx].hasTofMeasurement()) {
+        scheduleTransmission(idx, _canid_tof_data + idx, _boards[idx].tofMeasurement(), true);
+      }
+    }
+  } else if (data.size() >= 3 && data[0] == CMD_TOF_SCAN_REQUEST) {
+    const auto integration_us = static_cast<int>(_params.tof_integration_time_us);
+
+    std::uniform_int_distribution<int> jitter(-static_cast<int>(_params.jitter_us), static_cast<int>(_params.jitter_us));
+    for (const auto idx : selectBoards(data[1], data[2], true)) {
+      // the data available message is sent when the integration is finished
+      const auto duration = std::chrono::microseconds(std::max(0, integration_us + jitter(_rng)));
+      if (!chance(_params.drop_probability)) {
+        scheduleEvent(Clock::now() + duration, idx, _canid_tof_data + idx, { 0x01 }, true);
+      }
+    }
+  }
+}
+
+void SimulatedInterface::handleThermalRequest(const std::vector<uint8_t>& data) {
+  if (data.size() < 3) {
+    return;
+  }
+
+  // the EEPROM is configuration traffic and is not affected by the fault injection, the driver only requests it once
+  const bool inject_faults = (data[0] != CMD_THERMAL_EEPROM_REQUEST);
+  for (const auto idx : selectBoards(data[1], data[2], inject_faults)) {
+    switch (data[0]) {
+    case CMD_THERMAL_EEPROM_REQUEST:
+      scheduleTransmission(idx, _canid_thermal_data + idx, _boards[idx].thermalEeprom(), false);
+      break;
+    case CMD_THERMAL_DATA_REQUEST:
+      scheduleTransmission(idx, _canid_thermal_data + idx, _boards[idx].thermalMeasurement(), true);
+      break;
+    default:
+      // the scan runs in the background of the board and has no response
+      break;
+    }
+  }
+}
+
+std::vector<std::size_t> SimulatedInterface::selectBoards(std::uint8_t select_high, std::uint8_t select_low, bool inject_faults) {
+  const std::uint16_t select = static_cast<std::uint16_t>((select_high << 8) | select_low);
+
+  std::vector<std::size_t> selected;
+  for (std::size_t idx = 0; idx < _boards.size() && idx < 16; idx++) {
+    if ((select & (1 << idx)) && !(inject_faults && chance(_params.mute_probability))) {
+      selected.push_back(idx);
+    }
+  }
+  return selected;
+}
+
+void SimulatedInterface::scheduleTransmission(std::size_t board_idx, CanProtocol::canid id, std::vector<SimulatedSensorBoard::Payload> payloads, bool inject_faults) {
+  const auto frame_time = std::chrono::microseconds(_params.frame_time_us);
+
+  // the bus transmits one frame at a time, a response starts after all earlier frames
+  _bus_free_at = std::max(_bus_free_at, Clock::now());
+  for (auto& payload : payloads) {
+    if (inject_faults && chance(_params.drop_probability)) {
+      continue;
+    }
+
+    const int copies = (inject_faults && chance(_params.duplicate_probability)) ? 2 : 1;
+    for (int i = 0; i < copies; i++) {
+      _bus_free_at += frame_time;
+      scheduleEvent(_bus_free_at, board_idx, id, payload, false);
+    }
+  }
+}
+
+void SimulatedInterface::scheduleEvent(Clock::time_point time, std::size_t board_idx, CanProtocol::canid id, SimulatedSensorBoard::Payload payload, bool completes_tof_measurement) {
+  _events.push(Event{ time, _event_seq++, id, std::move(payload), board_idx, completes_tof_measurement });
+  _event_cv.notify_one();
+}
+
+bool SimulatedInterface::chance(double probability) {
+  if (probability <= 0.0) {
+    return false;
+  }
+  return std::uniform_real_distribution<double>(0.0, 1.0)(_rng) < probability;
+}
+
+bool SimulatedInterface::listener() {
+  PROFILE_THREAD(("sensorring rx " + _interface_name).c_str());
+  _shut_down_listener = false;
+
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Starting simulated listener on interface " + _interface_name);
+
+  std::unique_lock<std::mutex> lock(_event_mutex);
+  _listener_is_running = true;
+  while (!_shut_down_listener) {
+    // The timeout only bounds the reaction time to a shutdown request
+    const auto timeout = Clock::now() + RX_TIMEOUT;
+    if (_events.empty() || _events.top().time > Clock::now()) {
+      _event_cv.wait_until(lock, _events.empty() ? timeout : std::min(timeout, _events.top().time));
+      continue;
+    }
+
+    Event event = _events.top();
+    _events.pop();
+    if (event.completes_tof_measurement) {
+      _boards[event.board_idx].completeTofMeasurement();
+    }
+
+    lock.unlock();
+    PROFILE_COUNT_CAN_FRAMES(1);
+    try {
+      if (!notifyObservers(event.id, ByteSpan(event.payload.data(), event.payload.size()), utils::systemTimeNs())) {
+        LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Tried to map unknown CAN ID on interface " + _interface_name);
+      }
+    } catch (const std::exception& e) {
+      LOG_RATE_LIMITED(logger::LogVerbosity::Debug, std::chrono::seconds(1), "Error while processing a CAN frame on interface " + _interface_name + ": " + e.what());
+    }
+    lock.lock();
+  }
+  logger::Logger::getInstance()->log(logger::LogVerbosity::Debug, "Stopping simulated listener on interface " + _interface_name);
+
+  _listener_is_running = false;
+  return true;
+}
+
+void SimulatedInterface::fillEndpointMap() {
+  CanProtocol::canid canid_tof_status, canid_tof_request, canid_broadcast;
+  CanProtocol::makeCanStdID(SYSID_TOF, NODEID_TOF_STATUS, canid_tof_status, canid_tof_request, canid_broadcast);
+
+  CanProtocol::canid canid_thermal_status, canid_thermal_request, canid_thermal_broadcast;
+  CanProtocol::makeCanStdID(SYSID_THERMAL, NODEID_THERMAL_STATUS, canid_thermal_status, canid_thermal_request, canid_thermal_broadcast);
+
+  CanProtocol::canid canid_light_in, canid_light_out, canid_light;
+  CanProtocol::makeCanStdID(SYSID_LIGHT, NODEID_HEADLEFT, canid_light_in, canid_light_out, canid_light);
+
+  CanProtocol::canid canid_tof_data_out, canid_thermal_data_out;
+  CanProtocol::makeCanStdID(SYSID_TOF, NODEID_TOF_DATA, _canid_tof_data, canid_tof_data_out, canid_broadcast);
+  CanProtocol::makeCanStdID(SYSID_THERMAL, NODEID_THERMAL_DATA, _canid_thermal_data, canid_thermal_data_out, canid_thermal_broadcast);
+
+  _canid_broadcast = canid_broadcast;
+
+  _id_map[ComEndpoint("tof_status")]      = canid_tof_status;
+  _id_map[ComEndpoint("tof_request")]     = canid_tof_request;
+  _id_map[ComEndpoint("thermal_status")]  = canid_thermal_status;
+  _id_map[ComEndpoint("thermal_request")] = canid_thermal_request;
+  _id_map[ComEndpoint("light")]           = canid_light;
+  _id_map[ComEndpoint("broadcast")]       = canid_broadcast;
+}
+
+void SimulatedInterface::addToFSensorToEndpointMap(std::size_t idx) {
+  auto value                  = "tof" + std::to_string(idx) + "_data";
+  _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(_canid_tof_data + idx);
+  _endpoints.emplace(value);
+  updateDispatchTable();
+}
+
+void SimulatedInterface::addThermalSensorToEndpointMap(std::size_t idx) {
+  auto value                  = "thermal" + std::to_string(idx) + "_data";
+  _id_map[ComEndpoint(value)] = static_cast<CanProtocol::canid>(_canid_thermal_data + idx);
+  _endpoints.emplace(value);
+  updateDispatchTable();
+}
+
+std::uint32_t SimulatedInterface::mapEndpointToId(const ComEndpoint& endpoint) const {
+  return _id_map.at(endpoint); // may throw out_of_range exception
+}
+
+} // namespace com
+
+} // namespace eduart
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "interface/ComInterface.hpp"
+#include "interface/can/canprotocol.hpp"
+#include "sensorring/Parameter.hpp"
+
+#include "SimulatedSensorBoard.hpp"
+
+namespace eduart {
+
+namespace com {
+
+/**
+ * @class SimulatedInterface
+ * @brief Communication interface without hardware. The interface emulates a bus with a number of sensor boards that
+ * answer the commands of the sensor boards in the same way as the firmware does. The responses are delivered by the
+ * listener thread with realistic timing: Time-of-Flight measurements take their integration time and all frames share
+ * the bandwidth of the bus. Optional jitter and fault injection allow stress tests of the measurement pipeline.
+ */
+class SimulatedInterface : public ComInterface {
+public:
+  /**
+   * Constructor
+   * @param[in] interface_name name of the interface
+   * @param[in] params timing and fault injection of the emulated sensor boards
+   */
+  SimulatedInterface(std::string interface_name, bus::SimulationParams params);
+
+  /**
+   * Destructor
+   */
+  ~SimulatedInterface();
+
+  /**
+   * Open the interface. The simulated interface is always available.
+   * @param[in] interface_name name of the interface
+   * @return success==true
+   */
+  bool openInterface(std::string interface_name) override;
+
+  /**
+   * Send a command to the emulated sensor boards.
+   * @param[in] target ComEndpoint to which the message is sent.
+   * @param[in] data Message payload.
+   * @return success==true
+   */
+  bool send(ComEndpoint target, const std::vector<uint8_t>& data) override;
+
+  /**
+   * Close the interface.
+   * @return success==true
+   */
+  bool closeInterface() override;
+
+  /**
+   * Repair the connection in case of an error. Pending responses are discarded.
+   * @return success==true
+   */
+  bool repairInterface() override;
+
+  /**
+   * Add endpoint for a new tof sensor
+   * @param[in] idx index of the sensor
+   */
+  void addToFSensorToEndpointMap(std::size_t idx) override;
+
+  /**
+   * Add endpoint for a new thermal sensor
+   * @param[in] idx index of the sensor
+   */
+  void addThermalSensorToEndpointMap(std::size_t idx) override;
+
+protected:
+  std::uint32_t mapEndpointToId(const ComEndpoint& endpoint) const override;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  // Frame that is delivered to the observers at the given time
+  struct Event {
+    Clock::time_point time;
+    std::uint64_t seq;
+    CanProtocol::canid id;
+    SimulatedSensorBoard::Payload payload;
+    std::size_t board_idx;
+    bool completes_tof_measurement;
+  };
+
+  // Orders the events by time and by the order of scheduling
+  struct EventLater {
+    bool operator()(const Event& a, const Event& b) const {
+      return (a.time != b.time) ? (a.time > b.time) : (a.seq > b.seq);
+    }
+  };
+
+  void fillEndpointMap();
+
+  bool listener() override;
+
+  void handleBroadcast(const std::vector<uint8_t>& data);
+
+  void handleTofRequest(const std::vector<uint8_t>& data);
+
+  void handleThermalRequest(const std::vector<uint8_t>& data);
+
+  std::vector<std::size_t> selectBoards(std::uint8_t select_high, std::uint8_t select_low, bool inject_faults);
+
+  void scheduleTransmission(std::size_t board_idx, CanProtocol::canid id, std::vector<SimulatedSensorBoard::Payload> payloads, bool inject_faults);
+
+  void scheduleEvent(Clock::time_point time, std::size_t board_idx, CanProtocol::canid id, SimulatedSensorBoard::Payload payload, bool completes_tof_measurement);
+
+  bool chance(double probability);
+
+  static constexpr std::chrono::milliseconds RX_TIMEOUT = std::chrono::milliseconds(10);
+
+  bus::SimulationParams _params;
+
+  std::map<ComEndpoint, CanProtocol::canid> _id_map;
+
+  CanProtocol::canid _canid_broadcast;
+
+  CanProtocol::canid _canid_tof_data;
+
+  CanProtocol::canid _canid_thermal_data;
+
+  std::mutex _event_mutex;
+
+  std::condition_variable _event_cv;
+
+  std::priority_queue<Event, std::vector<Event>, EventLater> _events;
+
+  std::uint64_t _event_seq;
+
+  Clock::time_point _bus_free_at;
+
+  std::vector<SimulatedSensorBoard> _boards;
+
+  std::mt19937 _rng;
+};
+
+} // namespace com
+
+} // namespace eduart
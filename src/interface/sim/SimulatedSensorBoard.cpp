@@ -0,0 +1,137 @@
+#include "SimulatedSensorBoard.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "boardmanager/SensorBoardManager.hpp"
+#include "interface/can/canprotocol.hpp"
+#include "sensors/hardware/heimann_htpa32.hpp"
+#include "sensors/hardware/st_vl53l8cx.hpp"
+
+namespace eduart {
+
+namespace com {
+
+namespace {
+
+// Split a buffer into frames of equal length, the last frame is padded with zeros
+std::vector<SimulatedSensorBoard::Payload> splitIntoFrames(const std::uint8_t* data, std::size_t len, std::size_t frame_length) {
+  std::vector<SimulatedSensorBoard::Payload> frames;
+  for (std::size_t offset = 0; offset < len; offset += frame_length) {
+    SimulatedSensorBoard::Payload frame(frame_length, 0);
+    std::copy_n(data + offset, std::min(frame_length, len - offset), frame.begin());
+    frames.push_back(std::move(frame));
+  }
+  return frames;
+}
+
+constexpr double PI = 3.14159265358979323846;
+
+} // namespace
+
+SimulatedSensorBoard::SimulatedSensorBoard(std::size_t idx, unsigned int seed)
+    : _idx(idx)
+    , _rng(seed + static_cast<unsigned int>(idx)) {
+  reset();
+}
+
+void SimulatedSensorBoard::reset() {
+  _tof_measurement_available = false;
+  _tof_frame_id              = 0;
+  _thermal_frame_count       = 0;
+}
+
+SimulatedSensorBoard::Payload SimulatedSensorBoard::enumerationResponse() const {
+  // index, board type, firmware version and commit hash. The index on the bus starts at 1.
+  return { CMD_ACTIVE_DEVICE_RESPONSE,
+           static_cast<std::uint8_t>(_idx + 1),
+           static_cast<std::uint8_t>(sensor::SensorBoardType::Headlight),
+           1,
+           0,
+           0,
+           0x51,
+           0x4D,
+           0x00,
+           static_cast<std::uint8_t>(_idx + 1),
+           0,
+           0 };
+}
+
+void SimulatedSensorBoard::completeTofMeasurement() {
+  _tof_measurement_available = true;
+  _tof_frame_id++;
+}
+
+bool SimulatedSensorBoard::hasTofMeasurement() const {
+  return _tof_measurement_available;
+}
+
+std::vector<SimulatedSensorBoard::Payload> SimulatedSensorBoard::tofMeasurement() {
+  // A wall in front of the sensor that slowly moves back and forth
+  const double wall_mm = 1000.0 + 100.0 * static_cast<double>(_idx % 8) + 300.0 * std::sin(2.0 * PI * _tof_frame_id / 64.0);
+  std::normal_distribution<double> noise(0.0, 5.0);
+
+  std::vector<std::uint8_t> data(sensor::vl53l8::TOF_RESOLUTION * 3);
+  for (std::size_t i = 0; i < sensor::vl53l8::TOF_RESOLUTION; i++) {
+    // 14 bit distance in mm / 4 and 10 bit sigma in mm / 128
+    const auto distance_raw = static_cast<std::uint32_t>(std::clamp((wall_mm + noise(_rng)) * 4.0, 1.0, 16383.0));
+    const std::uint32_t sigma_raw = 3 * 128;
+    const std::uint32_t zone      = (distance_raw << 10) | sigma_raw;
+
+    data[i * 3 + 0] = static_cast<std::uint8_t>(zone >> 0);
+    data[i * 3 + 1] = static_cast<std::uint8_t>(zone >> 8);
+    data[i * 3 + 2] = static_cast<std::uint8_t>(zone >> 16);
+  }
+
+  auto frames = splitIntoFrames(data.data(), data.size(), TOF_FRAME_LENGTH);
+  frames.push_back({ 0x00, _tof_frame_id });
+  return frames;
+}
+
+std::vector<SimulatedSensorBoard::Payload> SimulatedSensorBoard::thermalEeprom() const {
+  // Without gradients and offsets the raw pixel values are used as they are. The ambient temperature is fixed to 25 °C.
+  sensor::htpa32::HTPA32Eeprom eeprom;
+  std::memset(&eeprom, 0, sizeof(eeprom));
+  eeprom.ptat_gradient = 0.0F;
+  eeprom.ptat_offset   = 2982.0F;
+  eeprom.vddth2        = 1;
+  eeprom.ptat_th2      = 1;
+
+  return splitIntoFrames(reinterpret_cast<const std::uint8_t*>(&eeprom), sizeof(eeprom), THERMAL_FRAME_LENGTH);
+}
+
+std::vector<SimulatedSensorBoard::Payload> SimulatedSensorBoard::thermalMeasurement() {
+  const std::uint16_t vdd  = 30000;
+  const std::uint16_t ptat = 30000;
+
+  // 256 electrical offsets followed by 1024 big endian pixel values
+  std::vector<std::uint8_t> data(256 * 2 + NUMBER_OF_PIXEL * 2, 0);
+  std::normal_distribution<double> noise(0.0, 4.0);
+
+  // A warm spot that circles around the center of the image
+  const double angle = 2.0 * PI * _thermal_frame_count / 32.0;
+  const double spot_x = 15.5 + 8.0 * std::cos(angle);
+  const double spot_y = 15.5 + 8.0 * std::sin(angle);
+  for (std::size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
+    const double dx    = static_cast<double>(i % PIXEL_PER_ROW) - spot_x;
+    const double dy    = static_cast<double>(i / PIXEL_PER_ROW) - spot_y;
+    const double value = 200.0 + 600.0 * std::exp(-(dx * dx + dy * dy) / 20.0) + noise(_rng);
+    const auto pixel   = static_cast<std::uint16_t>(std::clamp(value, 0.0, 4000.0));
+
+    data[512 + i * 2 + 0] = static_cast<std::uint8_t>(pixel >> 8);
+    data[512 + i * 2 + 1] = static_cast<std::uint8_t>(pixel >> 0);
+  }
+  _thermal_frame_count++;
+
+  std::vector<Payload> frames;
+  frames.push_back({ static_cast<std::uint8_t>(vdd >> 0), static_cast<std::uint8_t>(vdd >> 8), static_cast<std::uint8_t>(ptat >> 0), static_cast<std::uint8_t>(ptat >> 8) });
+  for (auto& frame : splitIntoFrames(data.data(), data.size(), THERMAL_FRAME_LENGTH)) {
+    frames.push_back(std::move(frame));
+  }
+  return frames;
+}
+
+} // namespace com
+
+} // namespace eduart
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace eduart {
+
+namespace com {
+
+/**
+ * @class SimulatedSensorBoard
+ * @brief Firmware model of a single sensor board with a VL53L8 Time-of-Flight sensor and a HTPA32 thermal sensor. The
+ * board only generates the payloads of its responses, the timing and delivery is handled by the SimulatedInterface.
+ * The Time-of-Flight sensor sees a wall whose distance slowly oscillates, the thermal sensor sees a warm spot in front
+ * of a background at room temperature.
+ */
+class SimulatedSensorBoard {
+public:
+  using Payload = std::vector<std::uint8_t>;
+
+  /**
+   * Constructor
+   * @param[in] idx index of the board on the bus, starting at 0
+   * @param[in] seed seed of the measurement noise
+   */
+  SimulatedSensorBoard(std::size_t idx, unsigned int seed);
+
+  /**
+   * Restore the state after power up
+   */
+  void reset();
+
+  /**
+   * Response to the enumeration query
+   * @return payload of the response
+   */
+  Payload enumerationResponse() const;
+
+  /**
+   * Complete the running Time-of-Flight measurement
+   */
+  void completeTofMeasurement();
+
+  /**
+   * Check if a completed Time-of-Flight measurement is available
+   * @return true if a measurement is available
+   */
+  bool hasTofMeasurement() const;
+
+  /**
+   * Payloads of the latest Time-of-Flight measurement. The data frames are followed by the transmission complete frame.
+   * @return payloads in transmission order
+   */
+  std::vector<Payload> tofMeasurement();
+
+  /**
+   * Payloads of the thermal sensor EEPROM
+   * @return payloads in transmission order
+   */
+  std::vector<Payload> thermalEeprom() const;
+
+  /**
+   * Payloads of a new thermal measurement. The vdd and ptat frame is followed by the data frames.
+   * @return payloads in transmission order
+   */
+  std::vector<Payload> thermalMeasurement();
+
+private:
+  static constexpr std::size_t TOF_FRAME_LENGTH     = 48;
+  static constexpr std::size_t THERMAL_FRAME_LENGTH = 64;
+
+  std::size_t _idx;
+  std::mt19937 _rng;
+
+  bool _tof_measurement_available;
+  std::uint8_t _tof_frame_id;
+  std::uint32_t _thermal_frame_count;
+};
+
+} // namespace com
+
+} // namespace eduart
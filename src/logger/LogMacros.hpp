@@ -0,0 +1,90 @@
+#pragma once
+
+/**
+ * Logging macros for hot paths. The message argument is only evaluated if a registered LoggerClient receives messages
+ * of the given verbosity, so no strings are built for messages that nobody reads.
+ *
+ * LOG_RATE_LIMITED(verbosity, interval, msg)    log at most one message per interval from the call site, the next
+ *                                               logged message reports the number of suppressed messages
+ *
+ * The rate limit is shared by all objects that reach the same call site, e.g. all instances of an interface. Messages
+ * with LogVerbosity::Exception must be logged without a rate limit, a suppressed message would not throw.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "sensorring/logger/Logger.hpp"
+
+namespace eduart {
+
+namespace logger {
+
+/**
+ * @class RateLimiter
+ * @brief Lock-free rate limit of one call site. The first caller after the interval expired wins the compare-and-swap
+ * and may log, all other callers only count the suppressed message.
+ */
+class RateLimiter {
+public:
+  /**
+   * Constructor
+   * @param[in] interval minimum time between two logged messages
+   */
+  explicit RateLimiter(std::chrono::steady_clock::duration interval)
+      : _interval(interval.count())
+      , _next(0)
+      , _suppressed(0) {}
+
+  /**
+   * Check if a message may be logged
+   * @param[out] suppressed number of messages that were suppressed since the last logged message
+   * @return true if the message may be logged
+   */
+  bool allow(std::uint64_t& suppressed) noexcept {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto next      = _next.load(std::memory_order_relaxed);
+    if (now < next || !_next.compare_exchange_strong(next, now + _interval, std::memory_order_relaxed)) {
+      _suppressed.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    suppressed = _suppressed.exchange(0, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * Append the number of suppressed messages to a message
+   * @param[in] msg log message
+   * @param[in] suppressed number of suppressed messages
+   * @return annotated log message
+   */
+  static std::string annotate(std::string msg, std::uint64_t suppressed) {
+    if (suppressed > 0) {
+      msg += " (suppressed " + std::to_string(suppressed) + " similar messages)";
+    }
+    return msg;
+  }
+
+private:
+  const std::chrono::steady_clock::rep _interval;
+  std::atomic<std::chrono::steady_clock::rep> _next;
+  std::atomic<std::uint64_t> _suppressed;
+};
+
+} // namespace logger
+
+} // namespace eduart
+
+#define LOG_RATE_LIMITED(verbosity, interval, msg)                                                \
+  do {                                                                                            \
+    const auto* log_instance_ = ::eduart::logger::Logger::getInstance();                          \
+    if (log_instance_->isEnabled(verbosity)) {                                                    \
+      static ::eduart::logger::RateLimiter rate_limiter_(interval);                               \
+      std::uint64_t suppressed_ = 0;                                                              \
+      if (rate_limiter_.allow(suppressed_)) {                                                     \
+        log_instance_->log(verbosity, ::eduart::logger::RateLimiter::annotate(msg, suppressed_)); \
+      }                                                                                           \
+    }                                                                                             \
+  } while (0)
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "sensorring/logger/Logger.hpp"
+#include "sensorring/logger/LoggerClient.hpp"
+#include "utils/BoundedRing.hpp"
+
+namespace eduart {
+
+namespace logger {
+
+/**
+ * @struct LogMessage
+ * @brief Log message waiting in the queue of the asynchronous Logger
+ */
+struct LogMessage {
+  LogVerbosity verbosity = LogVerbosity::Debug;
+  std::string msg;
+};
+
+/**
+ * @class LogQueue
+ * @brief Message queue of the asynchronous Logger. The logging threads push into a lock-free ring and only touch the
+ * mutex of the condition variables when the logger thread has to be woken up or, with LogOverflowPolicy::Block, when
+ * they have to wait for room in the full ring.
+ */
+class LogQueue {
+public:
+  /**
+   * Constructor
+   * @param[in] capacity number of messages the queue can hold
+   * @param[in] policy behavior when the queue is full
+   */
+  LogQueue(std::size_t capacity, LogOverflowPolicy policy)
+      : _ring(capacity)
+      , _policy(policy)
+      , _shut_down(false)
+      , _worker_id()
+      , _pop_count(0)
+      , _waiting_producers(0)
+      , _active_producers(0) {}
+
+  /**
+   * Push a message according to the overflow policy. Thread safe. After shutDown() the message is rejected.
+   * @param[in] message message to be queued
+   * @return number of messages that were dropped
+   */
+  std::size_t push(LogMessage&& message) {
+    // the producer is counted before it checks the flag, so shutDown() either rejects it or waitForProducers() waits for it
+    _active_producers.fetch_add(1);
+    const std::size_t dropped = _shut_down.load() ? 1 : pushMessage(std::move(message));
+    _active_producers.fetch_sub(1);
+    return dropped;
+  }
+
+  /**
+   * Pop the oldest message. Must only be called by the logger thread or after waitForProducers().
+   * @param[out] message oldest queued message
+   * @return false if the queue is empty
+   */
+  bool pop(LogMessage& message) {
+    if (!_ring.pop(message)) {
+      return false;
+    }
+
+    // the counters are sequentially consistent, so either the producer sees the pop or the pop sees the producer
+    _pop_count.fetch_add(1);
+    if (_waiting_producers.load() > 0) {
+      { std::lock_guard<std::mutex> guard(_mutex); }
+      _space_cv.notify_all();
+    }
+    return true;
+  }
+
+  /**
+   * Wait until a message is queued, the queue is shut down or the timeout expired
+   * @param[in] timeout longest time to wait
+   */
+  void wait(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait_for(lock, timeout, [this] { return !_ring.empty() || _shut_down.load(std::memory_order_acquire); });
+  }
+
+  /**
+   * Wake up the logger thread
+   */
+  void notify() { _cv.notify_one(); }
+
+  /**
+   * Request the logger thread to relay the remaining messages and stop
+   */
+  void shutDown() {
+    {
+      std::lock_guard<std::mutex> guard(_mutex);
+      _shut_down = true;
+    }
+    _cv.notify_one();
+    _space_cv.notify_all();
+  }
+
+  /**
+   * Wait until all producers that pushed before shutDown() finished, so the final drain sees their messages
+   */
+  void waitForProducers() const {
+    while (_active_producers.load() > 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  /**
+   * Check if the logger thread was requested to stop
+   * @return true if the queue is shut down
+   */
+  bool isShutDown() const { return _shut_down.load(std::memory_order_acquire); }
+
+  /**
+   * Mark the calling thread as the logger thread
+   */
+  void setWorker() { _worker_id.store(std::this_thread::get_id(), std::memory_order_release); }
+
+  /**
+   * Check if the calling thread is the logger thread. Messages logged by the clients during the notification are
+   * relayed directly, so they can not wait for room in the queue they are blocking.
+   * @return true if called by the logger thread
+   */
+  bool isWorker() const { return _worker_id.load(std::memory_order_acquire) == std::this_thread::get_id(); }
+
+private:
+  /**
+   * Push a message into the ring, makes room according to the overflow policy
+   * @param[in] message message to be queued
+   * @return number of messages that were dropped
+   */
+  std::size_t pushMessage(LogMessage&& message) {
+    std::size_t dropped = 0;
+    auto pop_count      = _pop_count.load();
+    while (!_ring.push(std::move(message))) {
+      if (_policy == LogOverflowPolicy::DropNewest || _shut_down.load(std::memory_order_acquire)) {
+        return dropped + 1;
+      }
+      if (_policy == LogOverflowPolicy::DropOldest) {
+        LogMessage oldest;
+        if (_ring.pop(oldest)) {
+          dropped++;
+        }
+      } else {
+        waitForRoom(pop_count);
+        pop_count = _pop_count.load();
+      }
+    }
+    notify();
+    return dropped;
+  }
+
+  /**
+   * Wake up the logger thread and wait until it popped a message or the queue is shut down
+   * @param[in] pop_count number of popped messages before the failed push
+   */
+  void waitForRoom(std::uint64_t pop_count) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _waiting_producers.fetch_add(1);
+    _cv.notify_one();
+    _space_cv.wait(lock, [this, pop_count] { return _pop_count.load() != pop_count || _shut_down.load(std::memory_order_acquire); });
+    _waiting_producers.fetch_sub(1);
+  }
+
+  utils::BoundedRing<LogMessage> _ring;
+
+  const LogOverflowPolicy _policy;
+
+  std::atomic<bool> _shut_down;
+
+  std::atomic<std::thread::id> _worker_id;
+
+  std::mutex _mutex;
+
+  std::condition_variable _cv;
+
+  std::condition_variable _space_cv;
+
+  std::atomic<std::uint64_t> _pop_count;
+
+  std::atomic<std::size_t> _waiting_producers;
+
+  std::atomic<std::size_t> _active_producers;
+};
+
+} // namespace logger
+
+} // namespace eduart
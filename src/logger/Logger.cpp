@@ -1,22 +1,44 @@
 #include "sensorring/logger/Logger.hpp"
 
 #include <algorithm>
+#include <exception>
+#include <stdexcept>
 
 #include "sensorring/logger/LoggerClient.hpp"
 
+#include "LogQueue.hpp"
+
 namespace eduart {
 
 namespace logger {
 
+// Only bounds the reaction time of the logger thread to a missed notification
+static constexpr std::chrono::milliseconds ASYNC_WAIT_TIMEOUT = std::chrono::milliseconds(10);
+
+Logger::Logger()
+    : _min_verbosity(static_cast<int>(LogVerbosity::Exception))
+    , _dropped_messages(0)
+    , _reported_dropped_messages(0) {
+}
+
+Logger::~Logger() {
+  stopAsync();
+}
+
 Logger* Logger::getInstance() noexcept {
   static Logger* instance = new Logger;
   return instance;
 }
 
 void Logger::registerClient(LoggerClient* client) noexcept {
+  registerClient(client, LogVerbosity::Debug);
+}
+
+void Logger::registerClient(LoggerClient* client, LogVerbosity min_verbosity) noexcept {
   if (client) {
     LockGuard lock(_client_mutex);
-    auto result = _clients.insert(client);
+    auto result = _clients.emplace(client, min_verbosity);
+    updateMinVerbosity();
 
     // Check if the client was registered
     if (result.second) {
@@ -33,6 +55,7 @@ void Logger::unregisterClient(LoggerClient* client) noexcept {
   if (client) {
     LockGuard lock(_client_mutex);
     auto result = _clients.erase(client);
+    updateMinVerbosity();
 
     // Check if the client was removed
     if (result > 0) {
@@ -46,10 +69,8 @@ void Logger::unregisterClient(LoggerClient* client) noexcept {
 }
 
 void Logger::log(const LogVerbosity verbosity, const std::string& msg) const {
-  LockGuard lock(_client_mutex);
-  for (auto& client : _clients) {
-    if (client)
-      client->onOutputLog(verbosity, msg);
+  if (isEnabled(verbosity)) {
+    enqueue(verbosity, msg);
   }
   if (verbosity == LogVerbosity::Exception) {
     throw std::runtime_error(msg);
@@ -60,6 +81,110 @@ void Logger::log(const LogVerbosity verbosity, const std::stringstream& msg) con
   log(verbosity, msg.str());
 }
 
+bool Logger::isEnabled(const LogVerbosity verbosity) const noexcept {
+  return static_cast<int>(verbosity) >= _min_verbosity.load(std::memory_order_relaxed) || verbosity == LogVerbosity::Exception;
+}
+
+bool Logger::startAsync(std::size_t capacity, LogOverflowPolicy policy) noexcept {
+  std::lock_guard<std::mutex> guard(_async_mutex);
+  if (std::atomic_load(&_queue)) {
+    return false;
+  }
+
+  try {
+    auto queue    = std::make_shared<LogQueue>(std::max<std::size_t>(capacity, 1), policy);
+    _async_thread = std::thread(&Logger::asyncWorker, this, queue);
+    std::atomic_store(&_queue, queue);
+  } catch (const std::exception&) {
+    return false;
+  }
+  return true;
+}
+
+void Logger::stopAsync() noexcept {
+  std::lock_guard<std::mutex> guard(_async_mutex);
+  auto queue = std::atomic_exchange(&_queue, std::shared_ptr<LogQueue>());
+  if (!queue) {
+    return;
+  }
+
+  queue->shutDown();
+  if (_async_thread.joinable()) {
+    _async_thread.join();
+  }
+
+  // relay the messages of threads that pushed while the logger thread finished, later pushes are rejected and counted
+  queue->waitForProducers();
+  LogMessage message;
+  while (queue->pop(message)) {
+    deliver(message.verbosity, message.msg);
+  }
+}
+
+bool Logger::isAsync() const noexcept {
+  return std::atomic_load(&_queue) != nullptr;
+}
+
+std::uint64_t Logger::getDroppedMessageCount() const noexcept {
+  return _dropped_messages.load(std::memory_order_relaxed);
+}
+
+void Logger::enqueue(const LogVerbosity verbosity, std::string msg) const {
+  const auto queue = std::atomic_load(&_queue);
+  if (!queue || queue->isWorker()) {
+    deliver(verbosity, msg);
+    return;
+  }
+
+  const auto dropped = queue->push(LogMessage{ verbosity, std::move(msg) });
+  if (dropped > 0) {
+    _dropped_messages.fetch_add(dropped, std::memory_order_relaxed);
+  }
+}
+
+void Logger::deliver(const LogVerbosity verbosity, const std::string& msg) const {
+  LockGuard lock(_client_mutex);
+  for (auto& [client, min_verbosity] : _clients) {
+    if (client && verbosity >= min_verbosity) {
+      try {
+        client->onOutputLog(verbosity, msg);
+      } catch (const std::exception&) {
+        // a failing client must not stop the relay to the other clients
+      }
+    }
+  }
+}
+
+void Logger::updateMinVerbosity() {
+  int min_verbosity = static_cast<int>(LogVerbosity::Exception);
+  for (const auto& [client, client_verbosity] : _clients) {
+    min_verbosity = std::min(min_verbosity, static_cast<int>(client_verbosity));
+  }
+  _min_verbosity.store(min_verbosity, std::memory_order_relaxed);
+}
+
+void Logger::asyncWorker(std::shared_ptr<LogQueue> queue) const {
+  queue->setWorker();
+
+  LogMessage message;
+  while (true) {
+    while (queue->pop(message)) {
+      deliver(message.verbosity, message.msg);
+    }
+
+    const auto dropped = _dropped_messages.load(std::memory_order_relaxed);
+    if (dropped != _reported_dropped_messages) {
+      deliver(LogVerbosity::Warning, "The log queue was full, dropped " + std::to_string(dropped - _reported_dropped_messages) + " log messages");
+      _reported_dropped_messages = dropped;
+    }
+
+    if (queue->isShutDown()) {
+      break;
+    }
+    queue->wait(ASYNC_WAIT_TIMEOUT);
+  }
+}
+
 } // namespace logger
 
-} // namespace eduart
\ No newline at end of file
+} // namespace eduart
@@ -11,6 +11,12 @@
 #define PACK( __Declaration__ ) __pragma( pack(push, 1) ) __Declaration__ __pragma( pack(pop))
 #endif
 
+// Functions with AVX2 intrinsics can be compiled next to the baseline code on x86-64 and selected at runtime
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SIMD_AVX2_DISPATCH
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
 namespace eduart
 {
 
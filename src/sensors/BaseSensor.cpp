@@ -15,6 +15,9 @@ BaseSensor::BaseSensor(com::ComInterface* interface, com::ComEndpoint target, st
     , _new_data_available_flag(false)
     , _new_data_in_buffer_flag(false)
     , _new_measurement_ready_flag(false)
+    , _frame_count(0)
+    , _receive_error_count(0)
+    , _completion_signal(nullptr)
 
 {
   addEndpoint(target);
@@ -49,6 +52,18 @@ void BaseSensor::setPose(math::Vector3 translation, math::Vector3 rotation) {
   _translation = translation;
   _rotation    = rotation;
   _rot_m       = math::rotMatrixFromEulerDegrees(_rotation);
+  onSetPose();
+}
+
+void BaseSensor::setCompletionSignal(utils::CompletionSignal* signal) {
+  _completion_signal = signal;
+}
+
+void BaseSensor::signalCompletion() {
+  auto signal = _completion_signal.load();
+  if (signal) {
+    signal->notify();
+  }
 }
 
 void BaseSensor::resetSensorState() {
@@ -66,7 +81,19 @@ void BaseSensor::clearDataFlag() {
   onClearDataFlag();
 }
 
-void BaseSensor::notify(const com::ComEndpoint source, const std::vector<uint8_t>& data) {
+std::uint64_t BaseSensor::getFrameCount() const {
+  return _frame_count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t BaseSensor::getReceiveErrorCount() const {
+  return _receive_error_count.load(std::memory_order_relaxed);
+}
+
+manager::LatencyHistogram BaseSensor::getDecodeLatency() const {
+  return _decode_latency.snapshot();
+}
+
+void BaseSensor::notify(const com::ComEndpoint& source, ByteSpan data) {
   canCallback(source, data);
 }
 
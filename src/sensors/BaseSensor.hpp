@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include "interface/ComEndpoints.hpp"
 #include "interface/ComInterface.hpp"
 #include "sensorring/math/Matrix3.hpp"
+#include "utils/CompletionSignal.hpp"
+#include "utils/LatencyRecorder.hpp"
 
 namespace eduart {
 
@@ -28,16 +33,24 @@ class BaseSensor : public com::ComObserver {
   void setEnable(bool enable);
 
   void setPose(math::Vector3 translation, math::Vector3 rotation);
+  void setCompletionSignal(utils::CompletionSignal* signal);
 
   void resetSensorState();
   void clearDataFlag();
 
-  void notify(const com::ComEndpoint source, const std::vector<uint8_t>& data) override;
-  virtual void canCallback(const com::ComEndpoint source, const std::vector<uint8_t>& data) = 0;
+  std::uint64_t getFrameCount() const;
+  std::uint64_t getReceiveErrorCount() const;
+  manager::LatencyHistogram getDecodeLatency() const;
+
+  void notify(const com::ComEndpoint& source, ByteSpan data) override;
+  virtual void canCallback(const com::ComEndpoint& source, ByteSpan data) = 0;
 
 protected:
   virtual void onResetSensorState() = 0;
   virtual void onClearDataFlag()    = 0;
+  virtual void onSetPose()          = 0;
+
+  void signalCompletion();
 
   std::size_t _idx;
   SensorState _error;
@@ -48,9 +61,16 @@ class BaseSensor : public com::ComObserver {
   math::Matrix3 _rot_m;
 
   bool _enable_flag;
-  bool _new_data_available_flag;
-  bool _new_data_in_buffer_flag;
-  bool _new_measurement_ready_flag;
+  std::atomic<bool> _new_data_available_flag;
+  std::atomic<bool> _new_data_in_buffer_flag;
+  std::atomic<bool> _new_measurement_ready_flag;
+
+  std::atomic<std::uint64_t> _frame_count;
+  std::atomic<std::uint64_t> _receive_error_count;
+  utils::LatencyRecorder _decode_latency;
+
+private:
+  std::atomic<utils::CompletionSignal*> _completion_signal;
 };
 
 } // namespace sensor
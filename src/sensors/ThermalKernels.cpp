@@ -0,0 +1,431 @@
+#include "ThermalKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "hardware/heimann_htpa32.hpp"
+#include "platform/Platform.hpp"
+#include "utils/Iron.hpp"
+
+#ifdef SIMD_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace eduart {
+
+namespace sensor {
+
+namespace kernels {
+
+namespace {
+
+constexpr std::size_t TABLE_SIZE = NROFADELEMENTS * NROFTAELEMENTS;
+
+// Index of the electrical offset of a pixel. The upper and the lower half of the sensor have 128 offsets each.
+inline std::size_t offsetIndex(std::size_t i, std::size_t len) {
+  return (i % 128) + (i >= len / 2 ? 128 : 0);
+}
+
+// Conversion of a double to uint32_t that is defined for negative values
+inline std::uint32_t toUint32(double x) {
+  return static_cast<std::uint32_t>(static_cast<std::int64_t>(x));
+}
+
+} // namespace
+
+namespace reference {
+
+template <typename T> void compensatePixels(const std::uint8_t* raw_pixel_data, const std::uint8_t* offset_data, const T* th_gradient_coeff, const T* th_offset_coeff, const T* vdd_comp, T ptat, std::size_t len, T* values) {
+  for (std::size_t i = 0; i < len; i++) {
+    std::size_t idx = i % 128;
+    if (i >= (len / 2))
+      idx += 128;
+
+    std::uint16_t raw_pixel = (raw_pixel_data[i * 2 + 0] << 8) | (raw_pixel_data[i * 2 + 1] << 0);
+    std::uint16_t offset    = (offset_data[idx * 2 + 0] << 0) | (offset_data[idx * 2 + 1] << 8);
+
+    values[i] = raw_pixel - th_gradient_coeff[i] * ptat - th_offset_coeff[i];
+    values[i] -= offset;
+    values[i] -= vdd_comp[idx];
+  }
+}
+
+template <typename T> std::size_t lookupTemperatures(const T* values, std::size_t table_col, std::int32_t dta, std::size_t len, T* temp_deg_c, T& min_deg_c, T& max_deg_c) {
+  std::size_t invalid = 0;
+
+  for (std::size_t i = 0; i < len; i++) {
+    long rounded          = std::lround(values[i] + TABLEOFFSET);
+    std::size_t table_row = static_cast<std::size_t>(rounded) >> ADEXPBITS;
+
+    if (rounded >= 0 && table_row * NROFTAELEMENTS + table_col + NROFTAELEMENTS + 1 < TABLE_SIZE) {
+      const unsigned int* row0 = htpa32::TempTable[table_row];
+      const unsigned int* row1 = row0 + NROFTAELEMENTS;
+
+      T vx     = ((((std::int32_t)row0[table_col + 1] - (std::int32_t)row0[table_col]) * dta) / (std::int32_t)TAEQUIDISTANCE) + (std::int32_t)row0[table_col];
+      T vy     = ((((std::int32_t)row1[table_col + 1] - (std::int32_t)row1[table_col]) * dta) / (std::int32_t)TAEQUIDISTANCE) + (std::int32_t)row1[table_col];
+      T digits = static_cast<T>(toUint32((vy - vx) * ((std::int32_t)(values[i] + TABLEOFFSET) - (std::int32_t)htpa32::YADValues[table_row]) / (std::int32_t)ADEQUIDISTANCE + vx));
+
+      temp_deg_c[i] = (digits - 2732.0F) / 10.0F;
+      if (temp_deg_c[i] < min_deg_c)
+        min_deg_c = temp_deg_c[i];
+      if (temp_deg_c[i] > max_deg_c)
+        max_deg_c = temp_deg_c[i];
+    } else {
+      temp_deg_c[i] = 0;
+      invalid++;
+    }
+  }
+
+  return invalid;
+}
+
+template <typename T> void normalizeGrayscale(const T* temp_deg_c, T t_min_deg_c, T delta_t, std::size_t len, std::uint8_t* gray) {
+  for (std::size_t i = 0; i < len; i++) {
+    T norm_val = ((temp_deg_c[i] - t_min_deg_c) / delta_t) * 255;
+    gray[i]    = static_cast<std::uint8_t>(std::clamp(std::round(norm_val), T(0), T(255)));
+  }
+}
+
+void applyPalette(const std::uint8_t* gray, std::size_t len, std::array<std::uint8_t, 3>* rgb) {
+  for (std::size_t i = 0; i < len; i++) {
+    rgb[i][0] = ThermalPalette::Iron[gray[i]][0];
+    rgb[i][1] = ThermalPalette::Iron[gray[i]][1];
+    rgb[i][2] = ThermalPalette::Iron[gray[i]][2];
+  }
+}
+
+} // namespace reference
+
+#ifdef SIMD_AVX2_DISPATCH
+namespace avx2 {
+
+bool isSupported() {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+SIMD_TARGET_AVX2 void compensatePixels(const std::uint8_t* raw_pixel_data, const std::uint8_t* offset_data, const double* th_gradient_coeff, const double* th_offset_coeff, const double* vdd_comp, double ptat, std::size_t len, double* values) {
+  const __m128i swap_bytes = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m256d ptat_pd    = _mm256_set1_pd(ptat);
+
+  // Four pixels never straddle a block of 128 electrical offsets
+  for (std::size_t i = 0; i < len; i += 4) {
+    const std::size_t idx = offsetIndex(i, len);
+
+    const __m128i raw_pixel = _mm_shuffle_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(raw_pixel_data + i * 2)), swap_bytes);
+    const __m128i offset    = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(offset_data + idx * 2));
+
+    __m256d value = _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(raw_pixel));
+    value         = _mm256_sub_pd(value, _mm256_mul_pd(_mm256_loadu_pd(th_gradient_coeff + i), ptat_pd));
+    value         = _mm256_sub_pd(value, _mm256_loadu_pd(th_offset_coeff + i));
+    value         = _mm256_sub_pd(value, _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(offset)));
+    value         = _mm256_sub_pd(value, _mm256_loadu_pd(vdd_comp + idx));
+    _mm256_storeu_pd(values + i, value);
+  }
+}
+
+SIMD_TARGET_AVX2 std::size_t lookupTemperatures(const double* values, std::size_t table_col, std::int32_t dta, std::size_t len, double* temp_deg_c, double& min_deg_c, double& max_deg_c) {
+  const int* table = reinterpret_cast<const int*>(&htpa32::TempTable[0][0]);
+  const int* yad   = reinterpret_cast<const int*>(&htpa32::YADValues[0]);
+
+  // The interpolation reads the next row and column as well. Rounded values at or above the limit are outside of the table.
+  const std::size_t max_row = (TABLE_SIZE - NROFTAELEMENTS - 2 - table_col) / NROFTAELEMENTS;
+  const __m256d limit       = _mm256_set1_pd(static_cast<double>((max_row + 1) << ADEXPBITS));
+
+  const __m256d zero      = _mm256_setzero_pd();
+  const __m256d one       = _mm256_set1_pd(1.0);
+  const __m256d half      = _mm256_set1_pd(0.5);
+  const __m256d neg_half  = _mm256_set1_pd(-0.5);
+  const __m256d inf       = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+  const __m256d neg_inf   = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+  const __m256d two_pow32 = _mm256_set1_pd(4294967296.0);
+  const __m128i col       = _mm_set1_epi32(static_cast<int>(table_col));
+  const __m128i dta_epi32 = _mm_set1_epi32(dta);
+  const __m128i row_size  = _mm_set1_epi32(NROFTAELEMENTS);
+
+  __m256d t_min       = inf;
+  __m256d t_max       = neg_inf;
+  std::size_t invalid = 0;
+
+  const std::size_t vec_len = len - len % 4;
+  for (std::size_t i = 0; i < vec_len; i += 4) {
+    const __m256d value = _mm256_add_pd(_mm256_loadu_pd(values + i), _mm256_set1_pd(TABLEOFFSET));
+
+    // round half away from zero like std::lround
+    const __m256d trunc = _mm256_round_pd(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256d frac  = _mm256_sub_pd(value, trunc);
+    __m256d rounded     = _mm256_add_pd(trunc, _mm256_and_pd(_mm256_cmp_pd(frac, half, _CMP_GE_OQ), one));
+    rounded             = _mm256_sub_pd(rounded, _mm256_and_pd(_mm256_cmp_pd(frac, neg_half, _CMP_LE_OQ), one));
+
+    const __m256d valid = _mm256_and_pd(_mm256_cmp_pd(rounded, zero, _CMP_GE_OQ), _mm256_cmp_pd(rounded, limit, _CMP_LT_OQ));
+    const __m128i row   = _mm_srai_epi32(_mm256_cvttpd_epi32(_mm256_and_pd(rounded, valid)), ADEXPBITS);
+    const __m128i cell  = _mm_add_epi32(_mm_mullo_epi32(row, row_size), col);
+
+    const __m128i t00 = _mm_i32gather_epi32(table, cell, 4);
+    const __m128i t01 = _mm_i32gather_epi32(table + 1, cell, 4);
+    const __m128i t10 = _mm_i32gather_epi32(table + NROFTAELEMENTS, cell, 4);
+    const __m128i t11 = _mm_i32gather_epi32(table + NROFTAELEMENTS + 1, cell, 4);
+
+    // The integer division truncates towards zero. The quotient of two integers is never close enough to the next
+    // integer to be rounded across it, so the truncated double division is exact.
+    const __m256d dx = _mm256_div_pd(_mm256_cvtepi32_pd(_mm_mullo_epi32(_mm_sub_epi32(t01, t00), dta_epi32)), _mm256_set1_pd(TAEQUIDISTANCE));
+    const __m256d dy = _mm256_div_pd(_mm256_cvtepi32_pd(_mm_mullo_epi32(_mm_sub_epi32(t11, t10), dta_epi32)), _mm256_set1_pd(TAEQUIDISTANCE));
+    const __m256d vx = _mm256_add_pd(_mm256_round_pd(dx, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), _mm256_cvtepi32_pd(t00));
+    const __m256d vy = _mm256_add_pd(_mm256_round_pd(dy, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), _mm256_cvtepi32_pd(t10));
+
+    const __m128i y_ad  = _mm_i32gather_epi32(yad, row, 4);
+    const __m256d delta = _mm256_cvtepi32_pd(_mm_sub_epi32(_mm256_cvttpd_epi32(value), y_ad));
+
+    // conversion to uint32_t, negative results wrap around
+    __m256d digits = _mm256_add_pd(_mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(vy, vx), delta), _mm256_set1_pd(ADEQUIDISTANCE)), vx);
+    digits         = _mm256_cvtepi32_pd(_mm256_cvttpd_epi32(digits));
+    digits         = _mm256_add_pd(digits, _mm256_and_pd(_mm256_cmp_pd(digits, zero, _CMP_LT_OQ), two_pow32));
+
+    const __m256d temp = _mm256_div_pd(_mm256_sub_pd(digits, _mm256_set1_pd(2732.0)), _mm256_set1_pd(10.0));
+    _mm256_storeu_pd(temp_deg_c + i, _mm256_and_pd(temp, valid));
+
+    t_min = _mm256_min_pd(t_min, _mm256_blendv_pd(inf, temp, valid));
+    t_max = _mm256_max_pd(t_max, _mm256_blendv_pd(neg_inf, temp, valid));
+    invalid += 4 - __builtin_popcount(_mm256_movemask_pd(valid));
+  }
+
+  alignas(32) double lanes[4];
+  _mm256_store_pd(lanes, t_min);
+  for (double lane : lanes) {
+    if (lane < min_deg_c)
+      min_deg_c = lane;
+  }
+  _mm256_store_pd(lanes, t_max);
+  for (double lane : lanes) {
+    if (lane > max_deg_c)
+      max_deg_c = lane;
+  }
+
+  return invalid + reference::lookupTemperatures(values + vec_len, table_col, dta, len - vec_len, temp_deg_c + vec_len, min_deg_c, max_deg_c);
+}
+
+SIMD_TARGET_AVX2 void normalizeGrayscale(const double* temp_deg_c, double t_min_deg_c, double delta_t, std::size_t len, std::uint8_t* gray) {
+  const __m256d t_min   = _mm256_set1_pd(t_min_deg_c);
+  const __m256d delta   = _mm256_set1_pd(delta_t);
+  const __m256d zero    = _mm256_setzero_pd();
+  const __m256d one     = _mm256_set1_pd(1.0);
+  const __m256d half    = _mm256_set1_pd(0.5);
+  const __m256d max_val = _mm256_set1_pd(255.0);
+
+  const std::size_t vec_len = len - len % 4;
+  for (std::size_t i = 0; i < vec_len; i += 4) {
+    __m256d norm_val = _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(temp_deg_c + i), t_min), delta), max_val);
+
+    // Clamping before rounding gives the same result and keeps the rounding in the positive range
+    norm_val            = _mm256_max_pd(_mm256_min_pd(norm_val, max_val), zero);
+    const __m256d trunc = _mm256_round_pd(norm_val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    norm_val            = _mm256_add_pd(trunc, _mm256_and_pd(_mm256_cmp_pd(_mm256_sub_pd(norm_val, trunc), half, _CMP_GE_OQ), one));
+
+    const __m128i epi32 = _mm256_cvttpd_epi32(norm_val);
+    const __m128i epi8  = _mm_packus_epi16(_mm_packus_epi32(epi32, epi32), _mm_setzero_si128());
+    const int packed    = _mm_cvtsi128_si32(epi8);
+    std::memcpy(gray + i, &packed, 4);
+  }
+
+  reference::normalizeGrayscale(temp_deg_c + vec_len, t_min_deg_c, delta_t, len - vec_len, gray + vec_len);
+}
+
+// Integer division of eight lanes that truncates towards zero. The double division is exact for 32 bit operands.
+SIMD_TARGET_AVX2 static inline __m256i divideEpi32(__m256i dividend, __m256d divisor) {
+  const __m128i lo = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(dividend)), divisor));
+  const __m128i hi = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(dividend, 1)), divisor));
+  return _mm256_set_m128i(hi, lo);
+}
+
+// Conversion of eight uint32_t lanes to float with a single rounding step
+SIMD_TARGET_AVX2 static inline __m256 convertEpu32(__m256i value) {
+  const __m256 hi = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(value, 16)), _mm256_set1_ps(65536.0F));
+  const __m256 lo = _mm256_cvtepi32_ps(_mm256_and_si256(value, _mm256_set1_epi32(0xFFFF)));
+  return _mm256_add_ps(hi, lo);
+}
+
+SIMD_TARGET_AVX2 void compensatePixels(const std::uint8_t* raw_pixel_data, const std::uint8_t* offset_data, const float* th_gradient_coeff, const float* th_offset_coeff, const float* vdd_comp, float ptat, std::size_t len, float* values) {
+  const __m128i swap_bytes = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  const __m256 ptat_ps     = _mm256_set1_ps(ptat);
+
+  // Eight pixels never straddle a block of 128 electrical offsets
+  for (std::size_t i = 0; i < len; i += 8) {
+    const std::size_t idx = offsetIndex(i, len);
+
+    const __m128i raw_pixel = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(raw_pixel_data + i * 2)), swap_bytes);
+    const __m128i offset    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(offset_data + idx * 2));
+
+    __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(raw_pixel));
+    value        = _mm256_sub_ps(value, _mm256_mul_ps(_mm256_loadu_ps(th_gradient_coeff + i), ptat_ps));
+    value        = _mm256_sub_ps(value, _mm256_loadu_ps(th_offset_coeff + i));
+    value        = _mm256_sub_ps(value, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(offset)));
+    value        = _mm256_sub_ps(value, _mm256_loadu_ps(vdd_comp + idx));
+    _mm256_storeu_ps(values + i, value);
+  }
+}
+
+SIMD_TARGET_AVX2 std::size_t lookupTemperatures(const float* values, std::size_t table_col, std::int32_t dta, std::size_t len, float* temp_deg_c, float& min_deg_c, float& max_deg_c) {
+  const int* table = reinterpret_cast<const int*>(&htpa32::TempTable[0][0]);
+  const int* yad   = reinterpret_cast<const int*>(&htpa32::YADValues[0]);
+
+  // The interpolation reads the next row and column as well. Rounded values at or above the limit are outside of the table.
+  const std::size_t max_row = (TABLE_SIZE - NROFTAELEMENTS - 2 - table_col) / NROFTAELEMENTS;
+  const __m256 limit        = _mm256_set1_ps(static_cast<float>((max_row + 1) << ADEXPBITS));
+
+  const __m256 zero       = _mm256_setzero_ps();
+  const __m256 one        = _mm256_set1_ps(1.0F);
+  const __m256 half       = _mm256_set1_ps(0.5F);
+  const __m256 neg_half   = _mm256_set1_ps(-0.5F);
+  const __m256 inf        = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  const __m256 neg_inf    = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+  const __m256d ta_dist   = _mm256_set1_pd(TAEQUIDISTANCE);
+  const __m256i col       = _mm256_set1_epi32(static_cast<int>(table_col));
+  const __m256i dta_epi32 = _mm256_set1_epi32(dta);
+  const __m256i row_size  = _mm256_set1_epi32(NROFTAELEMENTS);
+
+  __m256 t_min        = inf;
+  __m256 t_max        = neg_inf;
+  std::size_t invalid = 0;
+
+  const std::size_t vec_len = len - len % 8;
+  for (std::size_t i = 0; i < vec_len; i += 8) {
+    const __m256 value = _mm256_add_ps(_mm256_loadu_ps(values + i), _mm256_set1_ps(TABLEOFFSET));
+
+    // round half away from zero like std::lround
+    const __m256 trunc = _mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256 frac  = _mm256_sub_ps(value, trunc);
+    __m256 rounded     = _mm256_add_ps(trunc, _mm256_and_ps(_mm256_cmp_ps(frac, half, _CMP_GE_OQ), one));
+    rounded            = _mm256_sub_ps(rounded, _mm256_and_ps(_mm256_cmp_ps(frac, neg_half, _CMP_LE_OQ), one));
+
+    const __m256 valid = _mm256_and_ps(_mm256_cmp_ps(rounded, zero, _CMP_GE_OQ), _mm256_cmp_ps(rounded, limit, _CMP_LT_OQ));
+    const __m256i row  = _mm256_srai_epi32(_mm256_cvttps_epi32(_mm256_and_ps(rounded, valid)), ADEXPBITS);
+    const __m256i cell = _mm256_add_epi32(_mm256_mullo_epi32(row, row_size), col);
+
+    const __m256i t00 = _mm256_i32gather_epi32(table, cell, 4);
+    const __m256i t01 = _mm256_i32gather_epi32(table + 1, cell, 4);
+    const __m256i t10 = _mm256_i32gather_epi32(table + NROFTAELEMENTS, cell, 4);
+    const __m256i t11 = _mm256_i32gather_epi32(table + NROFTAELEMENTS + 1, cell, 4);
+
+    const __m256 vx = _mm256_cvtepi32_ps(_mm256_add_epi32(divideEpi32(_mm256_mullo_epi32(_mm256_sub_epi32(t01, t00), dta_epi32), ta_dist), t00));
+    const __m256 vy = _mm256_cvtepi32_ps(_mm256_add_epi32(divideEpi32(_mm256_mullo_epi32(_mm256_sub_epi32(t11, t10), dta_epi32), ta_dist), t10));
+
+    const __m256i y_ad = _mm256_i32gather_epi32(yad, row, 4);
+    const __m256 delta = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_cvttps_epi32(value), y_ad));
+
+    // conversion to uint32_t, negative results wrap around
+    const __m256 digits_raw = _mm256_add_ps(_mm256_div_ps(_mm256_mul_ps(_mm256_sub_ps(vy, vx), delta), _mm256_set1_ps(ADEQUIDISTANCE)), vx);
+    const __m256 digits     = convertEpu32(_mm256_cvttps_epi32(digits_raw));
+
+    const __m256 temp = _mm256_div_ps(_mm256_sub_ps(digits, _mm256_set1_ps(2732.0F)), _mm256_set1_ps(10.0F));
+    _mm256_storeu_ps(temp_deg_c + i, _mm256_and_ps(temp, valid));
+
+    t_min = _mm256_min_ps(t_min, _mm256_blendv_ps(inf, temp, valid));
+    t_max = _mm256_max_ps(t_max, _mm256_blendv_ps(neg_inf, temp, valid));
+    invalid += 8 - __builtin_popcount(_mm256_movemask_ps(valid));
+  }
+
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, t_min);
+  for (float lane : lanes) {
+    if (lane < min_deg_c)
+      min_deg_c = lane;
+  }
+  _mm256_store_ps(lanes, t_max);
+  for (float lane : lanes) {
+    if (lane > max_deg_c)
+      max_deg_c = lane;
+  }
+
+  return invalid + reference::lookupTemperatures(values + vec_len, table_col, dta, len - vec_len, temp_deg_c + vec_len, min_deg_c, max_deg_c);
+}
+
+SIMD_TARGET_AVX2 void normalizeGrayscale(const float* temp_deg_c, float t_min_deg_c, float delta_t, std::size_t len, std::uint8_t* gray) {
+  const __m256 t_min   = _mm256_set1_ps(t_min_deg_c);
+  const __m256 delta   = _mm256_set1_ps(delta_t);
+  const __m256 zero    = _mm256_setzero_ps();
+  const __m256 one     = _mm256_set1_ps(1.0F);
+  const __m256 half    = _mm256_set1_ps(0.5F);
+  const __m256 max_val = _mm256_set1_ps(255.0F);
+
+  const std::size_t vec_len = len - len % 8;
+  for (std::size_t i = 0; i < vec_len; i += 8) {
+    __m256 norm_val = _mm256_mul_ps(_mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(temp_deg_c + i), t_min), delta), max_val);
+
+    // Clamping before rounding gives the same result and keeps the rounding in the positive range
+    norm_val           = _mm256_max_ps(_mm256_min_ps(norm_val, max_val), zero);
+    const __m256 trunc = _mm256_round_ps(norm_val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    norm_val           = _mm256_add_ps(trunc, _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(norm_val, trunc), half, _CMP_GE_OQ), one));
+
+    const __m256i epi32 = _mm256_cvttps_epi32(norm_val);
+    const __m128i epi16 = _mm_packus_epi32(_mm256_castsi256_si128(epi32), _mm256_extracti128_si256(epi32, 1));
+    const __m128i epi8  = _mm_packus_epi16(epi16, epi16);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(gray + i), epi8);
+  }
+
+  reference::normalizeGrayscale(temp_deg_c + vec_len, t_min_deg_c, delta_t, len - vec_len, gray + vec_len);
+}
+
+} // namespace avx2
+#endif
+
+// Without AVX2 dispatch, e.g. on AArch64, all kernels fall back to the reference functions
+bool isAccelerated() {
+#ifdef SIMD_AVX2_DISPATCH
+  return avx2::isSupported();
+#else
+  return false;
+#endif
+}
+
+template <typename T> void compensatePixels(const std::uint8_t* raw_pixel_data, const std::uint8_t* offset_data, const T* th_gradient_coeff, const T* th_offset_coeff, const T* vdd_comp, T ptat, std::size_t len, T* values) {
+#ifdef SIMD_AVX2_DISPATCH
+  if (avx2::isSupported() && len % 16 == 0) {
+    avx2::compensatePixels(raw_pixel_data, offset_data, th_gradient_coeff, th_offset_coeff, vdd_comp, ptat, len, values);
+    return;
+  }
+#endif
+  reference::compensatePixels(raw_pixel_data, offset_data, th_gradient_coeff, th_offset_coeff, vdd_comp, ptat, len, values);
+}
+
+template <typename T> std::size_t lookupTemperatures(const T* values, std::size_t table_col, std::int32_t dta, std::size_t len, T* temp_deg_c, T& min_deg_c, T& max_deg_c) {
+#ifdef SIMD_AVX2_DISPATCH
+  if (avx2::isSupported()) {
+    return avx2::lookupTemperatures(values, table_col, dta, len, temp_deg_c, min_deg_c, max_deg_c);
+  }
+#endif
+  return reference::lookupTemperatures(values, table_col, dta, len, temp_deg_c, min_deg_c, max_deg_c);
+}
+
+template <typename T> void normalizeGrayscale(const T* temp_deg_c, T t_min_deg_c, T delta_t, std::size_t len, std::uint8_t* gray) {
+#ifdef SIMD_AVX2_DISPATCH
+  if (avx2::isSupported()) {
+    avx2::normalizeGrayscale(temp_deg_c, t_min_deg_c, delta_t, len, gray);
+    return;
+  }
+#endif
+  reference::normalizeGrayscale(temp_deg_c, t_min_deg_c, delta_t, len, gray);
+}
+
+void applyPalette(const std::uint8_t* gray, std::size_t len, std::array<std::uint8_t, 3>* rgb) {
+  reference::applyPalette(gray, len, rgb);
+}
+
+// Explicit template instantiation for the used types
+#define INSTANTIATE_THERMAL_KERNELS(T)                                                                                                                                                                                           \
+  template void compensatePixels<T>(const std::uint8_t*, const std::uint8_t*, const T*, const T*, const T*, T, std::size_t, T*);                                                                                            \
+  template std::size_t lookupTemperatures<T>(const T*, std::size_t, std::int32_t, std::size_t, T*, T&, T&);                                                                                                                  \
+  template void normalizeGrayscale<T>(const T*, T, T, std::size_t, std::uint8_t*);                                                                                                                                           \
+  template void reference::compensatePixels<T>(const std::uint8_t*, const std::uint8_t*, const T*, const T*, const T*, T, std::size_t, T*);                                                                                 \
+  template std::size_t reference::lookupTemperatures<T>(const T*, std::size_t, std::int32_t, std::size_t, T*, T&, T&);                                                                                                       \
+  template void reference::normalizeGrayscale<T>(const T*, T, T, std::size_t, std::uint8_t*);
+
+INSTANTIATE_THERMAL_KERNELS(float)
+INSTANTIATE_THERMAL_KERNELS(double)
+
+} // namespace kernels
+
+} // namespace sensor
+
+} // namespace eduart
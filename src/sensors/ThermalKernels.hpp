@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace eduart {
+
+namespace sensor {
+
+/**
+ * Pixel kernels of the thermal image pipeline in single and double precision. On x86-64 the kernels use AVX2 when the
+ * CPU supports it, which is checked once at runtime. All other platforms use the functions in the reference namespace,
+ * which implement the same operations pixel by pixel. Both paths produce bit-identical results for the same precision.
+ * There is no NEON path yet, so AArch64 always runs the reference functions.
+ */
+namespace kernels {
+
+/**
+ * Check if the kernels use SIMD instructions on this CPU
+ * @return false if the reference functions are used
+ */
+bool isAccelerated();
+
+/**
+ * Subtract the thermal and electrical offsets and the vdd compensation from the raw pixel values
+ * @param[in] raw_pixel_data big endian raw pixel values
+ * @param[in] offset_data little endian electrical offsets, 256 values
+ * @param[in] th_gradient_coeff thermal gradient coefficients with the EEPROM scale applied
+ * @param[in] th_offset_coeff thermal offsets from the EEPROM
+ * @param[in] vdd_comp vdd compensation of the current frame, 256 values
+ * @param[in] ptat ptat value of the current frame
+ * @param[in] len number of pixels
+ * @param[out] values compensated pixel values
+ */
+template <typename T> void compensatePixels(const std::uint8_t* raw_pixel_data, const std::uint8_t* offset_data, const T* th_gradient_coeff, const T* th_offset_coeff, const T* vdd_comp, T ptat, std::size_t len, T* values);
+
+/**
+ * Convert compensated pixel values to temperatures with the bilinear interpolation of the look-up table
+ * @param[in] values compensated pixel values
+ * @param[in] table_col look-up table column of the ambient temperature
+ * @param[in] dta distance of the ambient temperature to the look-up table column
+ * @param[in] len number of pixels
+ * @param[out] temp_deg_c temperatures in °C, pixels outside of the look-up table are set to zero
+ * @param[in,out] min_deg_c minimum temperature of all valid pixels
+ * @param[in,out] max_deg_c maximum temperature of all valid pixels
+ * @return number of pixels outside of the look-up table
+ */
+template <typename T> std::size_t lookupTemperatures(const T* values, std::size_t table_col, std::int32_t dta, std::size_t len, T* temp_deg_c, T& min_deg_c, T& max_deg_c);
+
+/**
+ * Scale temperatures to 8 bit gray values
+ * @param[in] temp_deg_c temperatures in °C
+ * @param[in] t_min_deg_c temperature mapped to 0
+ * @param[in] delta_t temperature range mapped to 0 ... 255, must not be zero
+ * @param[in] len number of pixels
+ * @param[out] gray gray values
+ */
+template <typename T> void normalizeGrayscale(const T* temp_deg_c, T t_min_deg_c, T delta_t, std::size_t len, std::uint8_t* gray);
+
+/**
+ * Map gray values to the colors of the Iron palette
+ * @param[in] gray gray values
+ * @param[in] len number of pixels
+ * @param[out] rgb colors
+ */
+void applyPalette(const std::uint8_t* gray, std::size_t len, std::array<std::uint8_t, 3>* rgb);
+
+namespace reference {
+
+template <typename T> void compensatePixels(const std::uint8_t* raw_pixel_data, const std::uint8_t* offset_data, const T* th_gradient_coeff, const T* th_offset_coeff, const T* vdd_comp, T ptat, std::size_t len, T* values);
+template <typename T> std::size_t lookupTemperatures(const T* values, std::size_t table_col, std::int32_t dta, std::size_t len, T* temp_deg_c, T& min_deg_c, T& max_deg_c);
+template <typename T> void normalizeGrayscale(const T* temp_deg_c, T t_min_deg_c, T delta_t, std::size_t len, std::uint8_t* gray);
+void applyPalette(const std::uint8_t* gray, std::size_t len, std::array<std::uint8_t, 3>* rgb);
+
+} // namespace reference
+
+} // namespace kernels
+
+} // namespace sensor
+
+} // namespace eduart
@@ -1,16 +1,20 @@
 #include "ThermalSensor.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 
 #include "interface/ComInterface.hpp"
 #include "interface/can/canprotocol.hpp"
 #include "utils/FileManager.hpp"
-#include "utils/Iron.hpp"
+#include "utils/Profiling.hpp"
 
+#include "logger/LogMacros.hpp"
 #include "sensorring/logger/Logger.hpp"
 
+#include "ThermalKernels.hpp"
+
 namespace eduart {
 
 namespace sensor {
@@ -23,8 +27,10 @@ ThermalSensor::ThermalSensor(ThermalSensorParams params, com::ComInterface* inte
   _interface->addThermalSensorToEndpointMap(idx);
   std::fill(std::begin(_rx_buffer), std::end(_rx_buffer), 0);
 
-  _vdd  = 0;
-  _ptat = 0;
+  _vdd                   = 0;
+  _ptat                  = 0;
+  _first_rx_timestamp_ns = 0;
+  _last_rx_timestamp_ns  = 0;
 
   _got_eeprom                = false;
   _got_calibration           = false;
@@ -38,10 +44,13 @@ ThermalSensor::ThermalSensor(ThermalSensorParams params, com::ComInterface* inte
 
   if (_params.use_eeprom_file) {
     _got_eeprom = filemanager::StructHandler<htpa32::HTPA32Eeprom>::readStructFromFile(_params.eeprom_dir, _eeprom_filename, _eeprom);
+    if (_got_eeprom) {
+      precomputeCoefficients();
+    }
   }
 
   if (_params.use_calibration_file) {
-    _got_calibration     = filemanager::ArrayHandler<double, NUMBER_OF_PIXEL>::readArrayFromFile(_params.calibration_dir, _calibration_filename, _calibration_image.data);
+    _got_calibration     = filemanager::ArrayHandler<measurement::TemperatureScalar, NUMBER_OF_PIXEL>::readArrayFromFile(_params.calibration_dir, _calibration_filename, _calibration_image.data);
     _calibration_average = _calibration_image.avg();
   }
 }
@@ -53,16 +62,20 @@ ThermalSensorParams ThermalSensor::getParams() const {
   return _params;
 }
 
+bool ThermalSensor::updateLatestMeasurement() {
+  return _measurement_buffer.update();
+}
+
 std::pair<const measurement::GrayscaleImage&, SensorState> ThermalSensor::getLatestGrayscaleImage() const {
-  return { _latest_measurement.grayscale_img, _error };
+  return { _measurement_buffer.readBuffer().grayscale_img, _error };
 }
 
 std::pair<const measurement::FalseColorImage&, SensorState> ThermalSensor::getLatestFalseColorImage() const {
-  return { _latest_measurement.falsecolor_img, _error };
+  return { _measurement_buffer.readBuffer().falsecolor_img, _error };
 }
 
 std::pair<const measurement::ThermalMeasurement&, SensorState> ThermalSensor::getLatestMeasurement() const {
-  return { _latest_measurement, _error };
+  return { _measurement_buffer.readBuffer(), _error };
 }
 
 bool ThermalSensor::gotEEPROM() const {
@@ -103,7 +116,10 @@ void ThermalSensor::onClearDataFlag() {
   _rx_buffer_offset = 0;
 }
 
-void ThermalSensor::canCallback([[maybe_unused]] const com::ComEndpoint source, const std::vector<uint8_t>& data) {
+void ThermalSensor::onSetPose() {
+}
+
+void ThermalSensor::canCallback([[maybe_unused]] const com::ComEndpoint& source, ByteSpan data) {
   std::size_t msg_size = data.size();
 
   if (!_got_eeprom) {
@@ -121,8 +137,10 @@ void ThermalSensor::canCallback([[maybe_unused]] const com::ComEndpoint source,
       _rx_buffer_offset += len;
 
       if (_rx_buffer_offset >= (int)sizeof(htpa32::HTPA32Eeprom)) {
+        precomputeCoefficients();
         _got_eeprom = true;
         filemanager::StructHandler<htpa32::HTPA32Eeprom>::saveStructToFile(_params.eeprom_dir, _eeprom_filename, _eeprom);
+        signalCompletion();
       }
     }
 
@@ -136,146 +154,151 @@ void ThermalSensor::canCallback([[maybe_unused]] const com::ComEndpoint source,
         // data message
       } else if (msg_size == MAX_MSG_LENGTH) {
         if ((_rx_buffer_offset + msg_size) <= (int)sizeof(_rx_buffer)) {
+          if (_rx_buffer_offset == 0) {
+            _first_rx_timestamp_ns = getRxTimestamp();
+          }
+          _last_rx_timestamp_ns = getRxTimestamp();
+
           std::copy_n(data.begin(), msg_size, (uint8_t*)&_rx_buffer + _rx_buffer_offset);
           _rx_buffer_offset += msg_size;
 
           if (_rx_buffer_offset >= sizeof(_rx_buffer)) {
-            _latest_measurement = processMeasurement(0, _rx_buffer, _eeprom, _vdd, _ptat, NUMBER_OF_PIXEL);
+            const auto decode_start = utils::LatencyRecorder::Clock::now();
+            auto& measurement       = _measurement_buffer.writeBuffer();
+            processMeasurement(0, _rx_buffer, _vdd, _ptat, NUMBER_OF_PIXEL, measurement);
 
             // calibration routine
             if (_calibration_active) {
               if (_calibration_count_current < _calibration_count_goal) {
-                _calibration_image += _latest_measurement.temp_data_deg_c;
+                _calibration_image += measurement.temp_data_deg_c;
                 _calibration_count_current++;
               }
               if (_calibration_count_current >= _calibration_count_goal) {
-                _calibration_image /= static_cast<double>(_calibration_count_current);
+                _calibration_image /= static_cast<measurement::TemperatureScalar>(_calibration_count_current);
                 _calibration_average = _calibration_image.avg();
                 _calibration_active  = false;
                 _got_calibration     = true;
 
                 if (_params.use_calibration_file) {
-                  filemanager::ArrayHandler<double, NUMBER_OF_PIXEL>::saveArrayToFile(_params.calibration_dir, _calibration_filename, _calibration_image.data);
+                  filemanager::ArrayHandler<measurement::TemperatureScalar, NUMBER_OF_PIXEL>::saveArrayToFile(_params.calibration_dir, _calibration_filename, _calibration_image.data);
                 }
               }
             }
 
             // apply calibration
             if (!_calibration_active && _got_calibration) {
-              _latest_measurement.temp_data_deg_c -= _calibration_image;
-              _latest_measurement.temp_data_deg_c += _calibration_average;
+              measurement.temp_data_deg_c -= _calibration_image;
+              measurement.temp_data_deg_c += static_cast<measurement::TemperatureScalar>(_calibration_average);
             }
 
-            if (_params.auto_min_max) {
-              _latest_measurement.grayscale_img = convertToGrayscaleImage(_latest_measurement.temp_data_deg_c, _latest_measurement.min_deg_c, _latest_measurement.max_deg_c);
-            } else {
-              _latest_measurement.grayscale_img = convertToGrayscaleImage(_latest_measurement.temp_data_deg_c, _params.t_min_deg_c, _params.t_max_deg_c);
-            }
+            // the false color image is derived from the grayscale image
+            if (_params.enable_grayscale_image || _params.enable_falsecolor_image) {
+              measurement::GrayscaleImage grayscale_img;
+              if (_params.auto_min_max) {
+                grayscale_img = convertToGrayscaleImage(measurement.temp_data_deg_c, measurement.min_deg_c, measurement.max_deg_c);
+              } else {
+                grayscale_img = convertToGrayscaleImage(measurement.temp_data_deg_c, _params.t_min_deg_c, _params.t_max_deg_c);
+              }
+              rotateLeftImage(grayscale_img);
 
-            rotateLeftImage(_latest_measurement.grayscale_img);
-            _latest_measurement.falsecolor_img = convertToFalseColorImage(_latest_measurement.grayscale_img);
-            _new_measurement_ready_flag        = true;
+              if (_params.enable_falsecolor_image) {
+                measurement.falsecolor_img = convertToFalseColorImage(grayscale_img);
+              }
+              if (_params.enable_grayscale_image) {
+                measurement.grayscale_img = grayscale_img;
+              }
+            }
+            _decode_latency.recordSince(decode_start);
+            _measurement_buffer.publish();
+            _frame_count.fetch_add(1, std::memory_order_relaxed);
+            _new_measurement_ready_flag = true;
+            signalCompletion();
           }
         } else {
           _error = SensorState::ReceiveError;
+          _receive_error_count.fetch_add(1, std::memory_order_relaxed);
         }
       }
     }
   }
 }
 
-const measurement::ThermalMeasurement ThermalSensor::processMeasurement(const uint8_t frame_id, const uint8_t* data, const htpa32::HTPA32Eeprom& eeprom, const uint16_t vdd, const uint16_t ptat, const size_t len) const {
-  uint16_t* offset_data    = (uint16_t*)(data + 0);   //  256 bytes of buffer are top offset values
-  uint16_t* raw_pixel_data = (uint16_t*)(data + 512); // 2048 bytes of buffer are pixel values
-
-  std::vector<double> buffer(len);
-
-  measurement::ThermalMeasurement result;
-  result.user_idx  = _params.user_idx;
-  result.frame_id  = frame_id;
-  result.min_deg_c = 1e6;
-
-  // ambient temperature
-  float t_ambient        = _ptat * eeprom.ptat_gradient + eeprom.ptat_offset;
-  result.t_ambient_deg_c = (t_ambient - 2732) / 10.0F;
+void ThermalSensor::precomputeCoefficients() {
+  // The EEPROM values are scaled by powers of two. Folding the scales into the coefficients keeps the results exact.
+  const double grad_scale     = std::ldexp(1.0, -static_cast<int>(_eeprom.grad_scale));
+  const double vddsc_gradient = std::ldexp(1.0, -static_cast<int>(_eeprom.vddsc_gradient + _eeprom.vddsc_offset));
+  const double vddsc_offset   = std::ldexp(1.0, -static_cast<int>(_eeprom.vddsc_offset));
 
-  // process raw buffer to thermal image
-  for (unsigned int i = 0; i < len; i++) {
-    int idx = i % 128;
-    if (i >= (len / 2))
-      idx += 128;
+  for (std::size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
+    _th_gradient_coeff[i] = static_cast<measurement::TemperatureScalar>(_eeprom.th_gradient[i] * grad_scale);
+    _th_offset_coeff[i]   = static_cast<measurement::TemperatureScalar>(_eeprom.th_offset[i]);
+  }
 
-    // deserialize thermal measurements. Everything is little endian except the raw pixel values which are big endian.
-    uint16_t raw_pixel = (((uint8_t*)raw_pixel_data)[i * 2 + 0] << 8) | (((uint8_t*)raw_pixel_data)[i * 2 + 1] << 0);
+  for (std::size_t i = 0; i < _vddcomp_gradient_coeff.size(); i++) {
+    _vddcomp_gradient_coeff[i] = _eeprom.vddcomp_gradient[i] * vddsc_gradient;
+    _vddcomp_offset_coeff[i]   = _eeprom.vddcomp_offset[i] * vddsc_offset;
+  }
+}
 
-    // thermal offsets
-    buffer[i] = raw_pixel - ((double)(eeprom.th_gradient[i] * ptat) / pow(2, eeprom.grad_scale)) - eeprom.th_offset[i];
+void ThermalSensor::processMeasurement(const uint8_t frame_id, const uint8_t* data, const uint16_t vdd, const uint16_t ptat, const size_t len, measurement::ThermalMeasurement& result) const {
+  PROFILE_ZONE("ThermalSensor::processMeasurement");
 
-    // electrical offsets
-    buffer[i] -= offset_data[idx];
+  const uint8_t* offset_data    = data + 0;   //  256 bytes of buffer are top offset values
+  const uint8_t* raw_pixel_data = data + 512; // 2048 bytes of buffer are pixel values
 
-    // The buffer can be used as an image from here on (after subtracting the electric offsets). The following steps are
-    // only to calculate temperatures in °C.
+  result.user_idx              = _params.user_idx;
+  result.frame_id              = frame_id;
+  result.first_rx_timestamp_ns = _first_rx_timestamp_ns;
+  result.last_rx_timestamp_ns  = _last_rx_timestamp_ns;
 
-    // vdd compensation
-    double vdd_comp_val1 = ((double)(_eeprom.vddcomp_gradient[idx] * ptat) / std::pow(2, _eeprom.vddsc_gradient) + _eeprom.vddcomp_offset[idx]) / std::pow(2, _eeprom.vddsc_offset);
-    double vdd_comp_val2 = (vdd - _eeprom.vddth1 - ((double)(_eeprom.vddth2 - _eeprom.vddth1) / (_eeprom.ptat_th2 - _eeprom.ptat_th1)) * (ptat - _eeprom.ptat_th1));
-    buffer[i]            = buffer[i] - (vdd_comp_val1 * vdd_comp_val2);
+  // ambient temperature
+  float t_ambient        = ptat * _eeprom.ptat_gradient + _eeprom.ptat_offset;
+  result.t_ambient_deg_c = (t_ambient - 2732) / 10.0F;
 
-    // look-up table and bilinear interpolation
-    std::size_t table_col = 0;
-    for (int j = 0; j < NROFTAELEMENTS; j++) {
-      if (t_ambient > htpa32::XTATemps[j]) {
-        table_col = j;
-      }
+  // The look-up table column only depends on the ambient temperature
+  std::size_t table_col = 0;
+  for (int j = 0; j < NROFTAELEMENTS; j++) {
+    if (t_ambient > htpa32::XTATemps[j]) {
+      table_col = j;
     }
+  }
+  const std::int32_t dta = std::lround(t_ambient - htpa32::XTATemps[table_col]);
 
-    std::size_t table_row = std::lround(buffer[i] + TABLEOFFSET);
-    table_row              = table_row >> ADEXPBITS; // ToDo: Table row too large. Causes Segfault when accessing the TempTable
-
-    if ((table_row < NROFADELEMENTS) && (table_col < NROFTAELEMENTS)) {
-      std::int32_t dta = std::lround(t_ambient - htpa32::XTATemps[table_col]);
-
-      double vx = ((((std::int32_t)htpa32::TempTable[table_row][table_col + 1] - (std::int32_t)htpa32::TempTable[table_row][table_col]) * dta) / (std::int32_t)TAEQUIDISTANCE) + (std::int32_t)htpa32::TempTable[table_row][table_col];
-      double vy = ((((std::int32_t)htpa32::TempTable[table_row + 1][table_col + 1] - (std::int32_t)htpa32::TempTable[table_row + 1][table_col]) * dta) / (std::int32_t)TAEQUIDISTANCE) + (std::int32_t)htpa32::TempTable[table_row + 1][table_col];
-      buffer[i] = (std::uint32_t)((vy - vx) * ((std::int32_t)(buffer[i] + TABLEOFFSET) - (std::int32_t)htpa32::YADValues[table_row]) / (std::int32_t)ADEQUIDISTANCE + (std::int32_t)vx);
-
-      // apply global offset
-      // buffer[i] += _eeprom.global_offset;
-
-      // calculate temperature in °C
-
-      result.temp_data_deg_c.data[i] = (buffer[i] - 2732.0F) / 10.0F;
-      if (result.temp_data_deg_c.data[i] < result.min_deg_c)
-        result.min_deg_c = result.temp_data_deg_c.data[i];
-      if (result.temp_data_deg_c.data[i] > result.max_deg_c)
-        result.max_deg_c = result.temp_data_deg_c.data[i];
-    } else {
-      logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Error occurred while processing thermal image");
-    }
+  // The vdd compensation only depends on the frame and the electrical offset index
+  const double vdd_comp_val2 = (vdd - _eeprom.vddth1 - ((double)(_eeprom.vddth2 - _eeprom.vddth1) / (_eeprom.ptat_th2 - _eeprom.ptat_th1)) * (ptat - _eeprom.ptat_th1));
+  std::array<measurement::TemperatureScalar, 256> vdd_comp;
+  for (std::size_t idx = 0; idx < vdd_comp.size(); idx++) {
+    vdd_comp[idx] = static_cast<measurement::TemperatureScalar>((_vddcomp_gradient_coeff[idx] * ptat + _vddcomp_offset_coeff[idx]) * vdd_comp_val2);
   }
 
-  return result;
+  // process raw buffer to thermal image. The values can be used as an image after subtracting the electric offsets,
+  // the look-up table is only needed to calculate temperatures in °C.
+  std::array<measurement::TemperatureScalar, NUMBER_OF_PIXEL> values;
+  kernels::compensatePixels(raw_pixel_data, offset_data, _th_gradient_coeff.data(), _th_offset_coeff.data(), vdd_comp.data(), static_cast<measurement::TemperatureScalar>(ptat), len, values.data());
+
+  measurement::TemperatureScalar min_deg_c = 1e6;
+  measurement::TemperatureScalar max_deg_c = 0;
+  std::size_t invalid                      = kernels::lookupTemperatures(values.data(), table_col, dta, len, result.temp_data_deg_c.data.data(), min_deg_c, max_deg_c);
+  result.min_deg_c                         = min_deg_c;
+  result.max_deg_c                         = max_deg_c;
+  if (invalid > 0) {
+    LOG_RATE_LIMITED(logger::LogVerbosity::Warning, std::chrono::seconds(1), "Error occurred while processing thermal image of sensor " + std::to_string(_params.user_idx));
+  }
 }
 
 const measurement::GrayscaleImage ThermalSensor::convertToGrayscaleImage(const measurement::TemperatureImage& temp_data_deg_c, const double t_min_deg_c, const double t_max_deg_c) const {
   measurement::GrayscaleImage result;
 
   // pixel data with min - max scaling
-  double delta_t = (t_max_deg_c - t_min_deg_c);
+  const auto t_min   = static_cast<measurement::TemperatureScalar>(t_min_deg_c);
+  const auto delta_t = static_cast<measurement::TemperatureScalar>(t_max_deg_c - t_min_deg_c);
   if (delta_t != 0) {
-    for (unsigned int i = 0; i < 512; i++) {
-      double norm_val = ((temp_data_deg_c.data[i] - t_min_deg_c) / delta_t) * 255;
-      result.data[i]  = static_cast<uint8_t>(std::clamp(std::round(norm_val), 0.0, 255.0));
-    }
+    kernels::normalizeGrayscale(temp_data_deg_c.data.data(), t_min, delta_t, 512, result.data.data());
 
     // rearrange lower half of the image. See Heimann HTPA32 Datasheet.
     for (unsigned int i = 512; i < 1024; i += 128) {
       for (unsigned int j = 0; j < 128; j += 32) {
-        for (unsigned int k = 0; k < 32; k++) {
-          double norm_val        = (temp_data_deg_c.data[i + (96 - j) + k] - t_min_deg_c) / delta_t * 255;
-          result.data[i + j + k] = static_cast<uint8_t>(std::clamp(std::round(norm_val), 0.0, 255.0));
-        }
+        kernels::normalizeGrayscale(temp_data_deg_c.data.data() + i + (96 - j), t_min, delta_t, 32, result.data.data() + i + j);
       }
     }
   }
@@ -287,11 +310,7 @@ const measurement::FalseColorImage ThermalSensor::convertToFalseColorImage(const
   measurement::FalseColorImage color_image;
 
   // convert latest measurement to false color image
-  for (size_t i = 0; i < NUMBER_OF_PIXEL; i++) {
-    color_image.data[i][0] = ThermalPalette::Iron[image.data[i]][0];
-    color_image.data[i][1] = ThermalPalette::Iron[image.data[i]][1];
-    color_image.data[i][2] = ThermalPalette::Iron[image.data[i]][2];
-  }
+  kernels::applyPalette(image.data.data(), NUMBER_OF_PIXEL, color_image.data.data());
 
   return color_image;
 }
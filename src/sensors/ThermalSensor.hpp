@@ -1,11 +1,14 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <vector>
 
 #include "hardware/heimann_htpa32.hpp"
 #include "interface/ComInterface.hpp"
 #include "sensorring/Parameter.hpp"
 #include "sensorring/types/ThermalMeasurement.hpp"
+#include "utils/TripleBuffer.hpp"
 
 #include "BaseSensor.hpp"
 
@@ -23,12 +26,13 @@ class ThermalSensor : public BaseSensor {
   bool stopCalibration();
   bool startCalibration(std::size_t window);
   ThermalSensorParams getParams() const;
+  bool updateLatestMeasurement();
 
   std::pair<const measurement::GrayscaleImage&, SensorState> getLatestGrayscaleImage() const;
   std::pair<const measurement::FalseColorImage&, SensorState> getLatestFalseColorImage() const;
   std::pair<const measurement::ThermalMeasurement&, SensorState> getLatestMeasurement() const;
 
-  void canCallback(const com::ComEndpoint source, const std::vector<uint8_t>& data) override;
+  void canCallback(const com::ComEndpoint& source, ByteSpan data) override;
 
   static void cmdRequestEEPROM(com::ComInterface* interface, std::uint16_t active_sensors);
   static void cmdRequestThermalMeasurement(com::ComInterface* interface, std::uint16_t active_sensors);
@@ -37,23 +41,33 @@ class ThermalSensor : public BaseSensor {
 private:
   void onResetSensorState() override;
   void onClearDataFlag() override;
+  void onSetPose() override;
 
   void rotateLeftImage(measurement::GrayscaleImage& image) const;
   const measurement::FalseColorImage convertToFalseColorImage(const measurement::GrayscaleImage& image) const;
   const measurement::GrayscaleImage convertToGrayscaleImage(const measurement::TemperatureImage& temp_data_deg_c, const double t_min_deg_c, const double t_max_deg_c) const;
-  const measurement::ThermalMeasurement processMeasurement(const uint8_t frame_id, const uint8_t* data, const htpa32::HTPA32Eeprom& eeprom, const uint16_t vdd, const uint16_t ptat, const size_t len) const;
+  void precomputeCoefficients();
+  void processMeasurement(const uint8_t frame_id, const uint8_t* data, const uint16_t vdd, const uint16_t ptat, const size_t len, measurement::ThermalMeasurement& result) const;
 
   const ThermalSensorParams _params;
   htpa32::HTPA32Eeprom _eeprom;
 
+  // EEPROM coefficients with the power of two scales already applied
+  std::array<measurement::TemperatureScalar, NUMBER_OF_PIXEL> _th_gradient_coeff;
+  std::array<measurement::TemperatureScalar, NUMBER_OF_PIXEL> _th_offset_coeff;
+  std::array<double, 256> _vddcomp_gradient_coeff;
+  std::array<double, 256> _vddcomp_offset_coeff;
+
   uint16_t _vdd;
   uint16_t _ptat;
-  measurement::ThermalMeasurement _latest_measurement;
+  utils::TripleBuffer<measurement::ThermalMeasurement> _measurement_buffer;
 
   uint8_t _rx_buffer[256 * 2 + NUMBER_OF_PIXEL * 2];
   std::size_t _rx_buffer_offset;
+  std::uint64_t _first_rx_timestamp_ns;
+  std::uint64_t _last_rx_timestamp_ns;
 
-  bool _got_eeprom;
+  std::atomic<bool> _got_eeprom;
   bool _got_calibration;
   bool _calibration_active;
   double _calibration_average;
@@ -1,22 +1,56 @@
 #include "TofSensor.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
+#include "boardmanager/SensorBoardManager.hpp"
 #include "interface/can/canprotocol.hpp"
 #include "sensorring/logger/Logger.hpp"
+#include "utils/Profiling.hpp"
 
 namespace eduart {
 
 namespace sensor {
 
+namespace {
+
+TofSensorInfo sensorInfo(TofResolution resolution) {
+  return SensorBoardManager::getToFSensorInfo(TofType::VL53L8, resolution);
+}
+
+// 24 bit little endian zone, reading byte by byte avoids unaligned reads past the end of the buffer
+bool decodeZone(const uint8_t* data, std::size_t zone_idx, double& distance, double& sigma) {
+  const uint32_t zone         = (uint32_t)data[zone_idx * 3 + 0] | ((uint32_t)data[zone_idx * 3 + 1] << 8) | ((uint32_t)data[zone_idx * 3 + 2] << 16);
+  const uint16_t distance_raw = (zone >> 10) & 0x3FFF; // 14 bit
+  const uint16_t sigma_raw    = (zone >> 0) & 0x03FF;  // 10 bit
+
+  distance = (double)distance_raw / 4.0F / 1000.0F; // Factor 4 for fixed point conversion, Factor 1000 from mm to m
+  sigma    = (double)sigma_raw / 128.0 / 1000.0F;   // Factor 128 for fixed point conversion, Factor 1000 from mm to m
+  return distance_raw != 0;
+}
+
+} // namespace
+
 TofSensor::TofSensor(TofSensorParams params, com::ComInterface* interface, std::size_t idx)
     : BaseSensor(interface, com::ComEndpoint("tof" + std::to_string(idx) + "_data"), idx, params.enable)
-    , _params(params) {
-
-  _rx_buffer_offset = 0;
+    , _params(params)
+    , _zone_count(static_cast<std::size_t>(sensorInfo(params.resolution).res_x * sensorInfo(params.resolution).res_y))
+    , _zones_per_row(static_cast<std::size_t>(sensorInfo(params.resolution).res_x))
+    , _max_rate(sensorInfo(params.resolution).max_rate)
+    , _lut_tan_x(params.resolution == TofResolution::res_4x4 ? vl53l8::lut_tan_x_4x4.data() : vl53l8::lut_tan_x.data())
+    , _lut_tan_y(params.resolution == TofResolution::res_4x4 ? vl53l8::lut_tan_y_4x4.data() : vl53l8::lut_tan_y.data()) {
+
+  _rx_buffer_offset      = 0;
+  _first_rx_timestamp_ns = 0;
+  _last_rx_timestamp_ns  = 0;
   _interface->addToFSensorToEndpointMap(idx);
   std::fill(std::begin(_rx_buffer), std::end(_rx_buffer), 0);
+
+  // unrotated directions until the pose is known
+  for (std::size_t i = 0; i < _zone_count; i++) {
+    _directions[i] = { _lut_tan_x[i], _lut_tan_y[i], 1.0 };
+  }
 }
 
 TofSensor::~TofSensor() {
@@ -26,12 +60,24 @@ const TofSensorParams& TofSensor::getParams() const {
   return _params;
 }
 
+std::size_t TofSensor::getZoneCount() const {
+  return _zone_count;
+}
+
+double TofSensor::getMaxRate() const {
+  return _max_rate;
+}
+
+bool TofSensor::updateLatestMeasurement() {
+  return _measurement_buffer.update();
+}
+
 std::pair<const measurement::TofMeasurement&, SensorState> TofSensor::getLatestRawMeasurement() const {
-  return { _latest_raw_measurement, _error };
+  return { _measurement_buffer.readBuffer().raw, _error };
 }
 
 std::pair<const measurement::TofMeasurement&, SensorState> TofSensor::getLatestTransformedMeasurement() const {
-  return { _latest_transformed_measurement, _error };
+  return { _measurement_buffer.readBuffer().transformed, _error };
 }
 
 void TofSensor::onResetSensorState() {
@@ -44,12 +90,24 @@ void TofSensor::onClearDataFlag() {
   _rx_buffer_offset = 0;
 }
 
-void TofSensor::canCallback([[maybe_unused]] const com::ComEndpoint source, const std::vector<uint8_t>& data) {
+void TofSensor::onSetPose() {
+  // Folding the rotation into the directions leaves a scale and a translation per point
+  for (std::size_t i = 0; i < _zone_count; i++) {
+    _directions[i] = _rot_m * math::Vector3{ _lut_tan_x[i], _lut_tan_y[i], 1.0 };
+  }
+}
+
+void TofSensor::canCallback([[maybe_unused]] const com::ComEndpoint& source, ByteSpan data) {
   std::size_t msg_size = data.size();
 
   // point data msg
   if (msg_size == 48) {
-    if ((_rx_buffer_offset + msg_size) <= (int)sizeof(_rx_buffer)) {
+    if ((_rx_buffer_offset + msg_size) <= sizeof(_rx_buffer)) {
+      if (_rx_buffer_offset == 0) {
+        _first_rx_timestamp_ns = getRxTimestamp();
+      }
+      _last_rx_timestamp_ns = getRxTimestamp();
+
       std::copy_n(data.begin(), msg_size, (uint8_t*)&_rx_buffer + _rx_buffer_offset);
       _rx_buffer_offset += msg_size;
       //_new_data_in_buffer_flag = true;
@@ -61,53 +119,96 @@ void TofSensor::canCallback([[maybe_unused]] const com::ComEndpoint source, cons
       }
     } else {
       _error = SensorState::ReceiveError;
+      _receive_error_count.fetch_add(1, std::memory_order_relaxed);
     }
 
     // transmission complete message
   } else if (msg_size == 2) {
     if (_new_data_in_buffer_flag) {
-      _latest_raw_measurement         = processMeasurement(data[1], _rx_buffer, vl53l8::TOF_RESOLUTION);
-      _latest_transformed_measurement = transformTofMeasurements(_latest_raw_measurement, _rot_m, _translation);
-      _new_data_in_buffer_flag        = false;
-      _new_measurement_ready_flag     = true;
+      // decode in place to reuse the memory of an earlier measurement, the reader never sees the back buffer
+      {
+        utils::ScopedLatency latency(_decode_latency);
+        auto& frame = _measurement_buffer.writeBuffer();
+        processMeasurement(data[1], _rx_buffer, static_cast<int>(_zone_count), frame);
+      }
+      _measurement_buffer.publish();
+      _frame_count.fetch_add(1, std::memory_order_relaxed);
+      _new_data_in_buffer_flag    = false;
+      _new_measurement_ready_flag = true;
+      signalCompletion();
     }
 
     // data available message
   } else if (msg_size == 1) {
     _new_data_available_flag = true;
+    signalCompletion();
   }
 }
 
-measurement::TofMeasurement TofSensor::processMeasurement(int frame_id, uint8_t* data, int len) const {
-  measurement::TofMeasurement measurement;
-  measurement.point_cloud.data.reserve(vl53l8::TOF_RESOLUTION);
-  measurement.frame_id = frame_id;
+void TofSensor::processMeasurement(int frame_id, const uint8_t* data, int len, TofFrame& frame) const {
+  PROFILE_ZONE("TofSensor::processMeasurement");
 
-  uint16_t distance_raw = 0;
-  uint16_t sigma_raw    = 0;
+  // resize() keeps the capacity, so only the very first measurement allocates
+  frame.raw.frame_id                      = frame_id;
+  frame.raw.first_rx_timestamp_ns         = _first_rx_timestamp_ns;
+  frame.raw.last_rx_timestamp_ns          = _last_rx_timestamp_ns;
+  frame.transformed.frame_id              = frame_id;
+  frame.transformed.first_rx_timestamp_ns = _first_rx_timestamp_ns;
+  frame.transformed.last_rx_timestamp_ns  = _last_rx_timestamp_ns;
+  frame.raw.point_cloud.data.resize(len);
+  frame.transformed.point_cloud.data.resize(len);
 
-  for (int i = 0; i < len; i++) {
-    distance_raw = (*((uint32_t*)(data + i * 3)) >> 10) & 0x3FFF; // 14 bit
-    sigma_raw    = (*((uint32_t*)(data + i * 3)) >> 0) & 0x03FF;  // 10 bit
+  measurement::PointData* raw_points         = frame.raw.point_cloud.data.data();
+  measurement::PointData* transformed_points = frame.transformed.point_cloud.data.data();
 
-    math::Vector3 point   = { 0, 0, 0 };
-    double point_distance = -1;
-    double point_sigma    = -1;
+  // number of measured 8x8 zones along one row of a binned zone
+  const std::size_t merged = vl53l8::TOF_ZONES_PER_ROW / _zones_per_row;
 
-    if (distance_raw != 0) {
-      point_distance = (double)distance_raw / 4.0F / 1000.0F; // Factor 4 for fixed point conversion, Factor 1000 from mm to m
-      point_sigma    = (double)sigma_raw / 128.0 / 1000.0F;   // Factor 128 for fixed point conversion, Factor 1000 from mm to m
+  for (int i = 0; i < len; i++) {
+    math::Vector3 point       = { 0, 0, 0 };
+    math::Vector3 transformed = _translation;
+    double point_distance     = -1;
+    double point_sigma        = -1;
+
+    if (merged == 1) {
+      if (!decodeZone(data, i, point_distance, point_sigma)) {
+        point_distance = -1;
+        point_sigma    = -1;
+      }
+    } else {
+      // average the valid zones of the bin, the sigma of the mean shrinks with the number of zones
+      const std::size_t row   = (i / _zones_per_row) * merged;
+      const std::size_t col   = (i % _zones_per_row) * merged;
+      std::size_t valid_zones = 0;
+      double distance_sum     = 0;
+      double variance_sum     = 0;
+      for (std::size_t r = row; r < row + merged; r++) {
+        for (std::size_t c = col; c < col + merged; c++) {
+          double distance, sigma;
+          if (decodeZone(data, r * vl53l8::TOF_ZONES_PER_ROW + c, distance, sigma)) {
+            distance_sum += distance;
+            variance_sum += sigma * sigma;
+            valid_zones++;
+          }
+        }
+      }
+      if (valid_zones > 0) {
+        point_distance = distance_sum / valid_zones;
+        point_sigma    = std::sqrt(variance_sum) / valid_zones;
+      }
+    }
 
-      point.x() = point_distance * vl53l8::lut_tan_x[i];
-      point.y() = point_distance * vl53l8::lut_tan_y[i];
+    if (point_distance >= 0) {
+      point.x() = point_distance * _lut_tan_x[i];
+      point.y() = point_distance * _lut_tan_y[i];
       point.z() = point_distance;
+
+      transformed = _directions[i] * point_distance + _translation;
     }
 
-    measurement.point_cloud.data.push_back(measurement::PointData({ point, point_distance, point_sigma, _params.user_idx }));
+    raw_points[i]         = { point, point_distance, point_sigma, _params.user_idx };
+    transformed_points[i] = { transformed, point_distance, point_sigma, _params.user_idx };
   }
-
-  measurement.point_cloud.data.shrink_to_fit();
-  return measurement;
 }
 
 void TofSensor::cmdRequestTofMeasurement(com::ComInterface* interface, std::uint16_t active_sensors) {
@@ -132,17 +233,6 @@ void TofSensor::cmdFetchTofMeasurement(com::ComInterface* interface, std::uint16
   }
 }
 
-measurement::TofMeasurement TofSensor::transformTofMeasurements(const measurement::TofMeasurement& measurement, const math::Matrix3 rotation, const math::Vector3 translation) {
-
-  auto transformed_measurement = measurement;
-
-  for (unsigned int i = 0; i < transformed_measurement.point_cloud.data.size(); i++) {
-    transformed_measurement.point_cloud.data[i].point = (rotation * measurement.point_cloud.data[i].point) + translation;
-  }
-
-  return transformed_measurement;
-}
-
 } // namespace sensor
 
 } // namespace eduart
\ No newline at end of file
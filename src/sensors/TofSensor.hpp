@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "sensorring/Parameter.hpp"
 #include "sensorring/math/Math.hpp"
 #include "sensorring/types/TofMeasurement.hpp"
+#include "utils/TripleBuffer.hpp"
 
 #include "BaseSensor.hpp"
 
@@ -21,28 +23,45 @@ class TofSensor : public BaseSensor {
   ~TofSensor();
 
   const TofSensorParams& getParams() const;
+  std::size_t getZoneCount() const;
+  double getMaxRate() const;
+  bool updateLatestMeasurement();
   std::pair<const measurement::TofMeasurement&, SensorState> getLatestRawMeasurement() const;
   std::pair<const measurement::TofMeasurement&, SensorState> getLatestTransformedMeasurement() const;
 
-  void canCallback(const com::ComEndpoint source, const std::vector<uint8_t>& data) override;
+  void canCallback(const com::ComEndpoint& source, ByteSpan data) override;
 
   static void cmdRequestTofMeasurement(com::ComInterface* interface, std::uint16_t active_sensors);
   static void cmdFetchTofMeasurement(com::ComInterface* interface, std::uint16_t active_sensors);
 
-  static measurement::TofMeasurement transformTofMeasurements(const measurement::TofMeasurement& measurement, const math::Matrix3 rotation, const math::Vector3 translation);
-
 private:
   void onResetSensorState() override;
   void onClearDataFlag() override;
+  void onSetPose() override;
+
+  struct TofFrame {
+    measurement::TofMeasurement raw;
+    measurement::TofMeasurement transformed;
+  };
 
-  measurement::TofMeasurement processMeasurement(int frame_id, uint8_t* data, int len) const;
+  void processMeasurement(int frame_id, const uint8_t* data, int len, TofFrame& frame) const;
 
   const TofSensorParams _params;
-  measurement::TofMeasurement _latest_raw_measurement;
-  measurement::TofMeasurement _latest_transformed_measurement;
+  const std::size_t _zone_count;
+  const std::size_t _zones_per_row;
+  const double _max_rate;
+  const double* _lut_tan_x;
+  const double* _lut_tan_y;
+
+  // viewing direction of each zone with the rotation of the sensor already applied
+  std::array<math::Vector3, vl53l8::TOF_RESOLUTION> _directions;
+  utils::TripleBuffer<TofFrame> _measurement_buffer;
 
+  // the sensor always transmits 8x8 zones, only the first 3 bytes per zone are used
   uint8_t _rx_buffer[vl53l8::TOF_RESOLUTION * 3];
   std::size_t _rx_buffer_offset;
+  std::uint64_t _first_rx_timestamp_ns;
+  std::uint64_t _last_rx_timestamp_ns;
 };
 
 } // namespace sensor
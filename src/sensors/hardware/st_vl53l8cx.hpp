@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace eduart {
@@ -8,34 +10,36 @@ namespace sensor {
 
 namespace vl53l8 {
 
-static constexpr std::uint8_t TOF_RESOLUTION = 64;
-
-// clang-format off
-  static const double lut_tan_x[] = {
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624,
-      0.3624,0.2589,0.1553,0.0518,-0.0518,-0.1553,-0.2589,-0.3624
-  };
-
-  static const double lut_tan_y[] = {
-      0.3624, 0.3624, 0.3624, 0.3624, 0.3624, 0.3624, 0.3624, 0.3624,
-      0.2589, 0.2589, 0.2589, 0.2589, 0.2589, 0.2589, 0.2589, 0.2589,
-      0.1553, 0.1553, 0.1553, 0.1553, 0.1553, 0.1553, 0.1553, 0.1553,
-      0.0518, 0.0518, 0.0518, 0.0518, 0.0518, 0.0518, 0.0518, 0.0518,
-      -0.0518, -0.0518, -0.0518, -0.0518, -0.0518, -0.0518, -0.0518, -0.0518,
-      -0.1553, -0.1553, -0.1553, -0.1553, -0.1553, -0.1553, -0.1553, -0.1553,
-      -0.2589, -0.2589, -0.2589, -0.2589, -0.2589, -0.2589, -0.2589, -0.2589,
-      -0.3624, -0.3624, -0.3624, -0.3624, -0.3624, -0.3624, -0.3624, -0.3624
-  };
-// clang-format on
+static constexpr std::uint8_t TOF_RESOLUTION     = 64;
+static constexpr std::uint8_t TOF_RESOLUTION_4X4 = 16;
+static constexpr std::uint8_t TOF_ZONES_PER_ROW  = 8;
+
+// Tangents of the zone center angles of one row, respectively one column of zones. The centers are equidistant in
+// tangent space, so the center of a binned 4x4 zone is the mean of the two 8x8 zones it covers.
+static constexpr std::array<double, TOF_ZONES_PER_ROW> ZONE_TAN = { 0.3624, 0.2589, 0.1553, 0.0518, -0.0518, -0.1553, -0.2589, -0.3624 };
+
+// Expands the zone tangents to all zones. The zones are ordered row by row.
+template <std::size_t ZONES_PER_ROW> constexpr std::array<double, ZONES_PER_ROW * ZONES_PER_ROW> makeTanLut(bool along_row) {
+  constexpr std::size_t MERGED = TOF_ZONES_PER_ROW / ZONES_PER_ROW;
+
+  std::array<double, ZONES_PER_ROW * ZONES_PER_ROW> lut{};
+  for (std::size_t i = 0; i < lut.size(); i++) {
+    const std::size_t zone = along_row ? i % ZONES_PER_ROW : i / ZONES_PER_ROW;
+    for (std::size_t j = 0; j < MERGED; j++) {
+      lut[i] += ZONE_TAN[zone * MERGED + j];
+    }
+    lut[i] /= MERGED;
+  }
+  return lut;
+}
+
+static constexpr std::array<double, TOF_RESOLUTION> lut_tan_x         = makeTanLut<8>(true);
+static constexpr std::array<double, TOF_RESOLUTION> lut_tan_y         = makeTanLut<8>(false);
+static constexpr std::array<double, TOF_RESOLUTION_4X4> lut_tan_x_4x4 = makeTanLut<4>(true);
+static constexpr std::array<double, TOF_RESOLUTION_4X4> lut_tan_y_4x4 = makeTanLut<4>(false);
 
 } // namespace vl53l8
 
 } // namespace sensor
 
-} // namespace eduart
\ No newline at end of file
+} // namespace eduart
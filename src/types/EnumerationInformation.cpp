@@ -59,7 +59,7 @@ bool EnumerationInformation::isUndefined() const noexcept {
   return *this == undefined_ref;
 }
 
-EnumerationInformation EnumerationInformation::fromBuffer(const std::vector<uint8_t>& buffer) {
+EnumerationInformation EnumerationInformation::fromBuffer(ByteSpan buffer) {
   EnumerationInformation info;
   if (buffer.size() >= 10) {
     info.idx     = static_cast<unsigned int>(buffer[1]);
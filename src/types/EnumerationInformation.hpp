@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "boardmanager/SensorBoardManager.hpp"
+#include "types/Span.hpp"
 
 namespace eduart {
 
@@ -53,7 +54,7 @@ struct EnumerationInformation {
 
   bool isUndefined() const noexcept;
 
-  static EnumerationInformation fromBuffer(const std::vector<uint8_t>& buffer);
+  static EnumerationInformation fromBuffer(ByteSpan buffer);
 
   friend bool operator==(const EnumerationInformation& lhs, unsigned int rhs) noexcept;
 
@@ -9,6 +9,7 @@ namespace measurement {
 
 // Explicit template instantiation for the used types
 template struct GenericGrayscaleImage<std::uint8_t, THERMAL_RESOLUTION>;
+template struct GenericGrayscaleImage<float, THERMAL_RESOLUTION>;
 template struct GenericGrayscaleImage<double, THERMAL_RESOLUTION>;
 
 template <typename T, std::size_t RESOLUTION> double GenericGrayscaleImage<T, RESOLUTION>::avg() {
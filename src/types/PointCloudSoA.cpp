@@ -0,0 +1,92 @@
+#include "sensorring/types/PointCloudSoA.hpp"
+
+#include <algorithm>
+
+namespace eduart {
+
+namespace measurement {
+
+template <typename T> void GenericPointCloudSoA<T>::reserve(std::size_t count) {
+  if (count <= _stride) {
+    return;
+  }
+
+  // Relocate the columns to the new stride
+  std::vector<T> data(COLUMNS * count, T(0));
+  for (std::size_t c = 0; c < COLUMNS; ++c) {
+    std::copy_n(column(c), _size, data.data() + c * count);
+  }
+
+  _data   = std::move(data);
+  _stride = count;
+}
+
+template <typename T> void GenericPointCloudSoA<T>::resize(std::size_t count) {
+  if (count > _stride) {
+    reserve(std::max(count, 2 * _stride));
+  }
+
+  if (count > _size) {
+    for (std::size_t c = 0; c < COLUMNS; ++c) {
+      std::fill(column(c) + _size, column(c) + count, T(0));
+    }
+  }
+
+  _size = count;
+}
+
+template <typename T> void GenericPointCloudSoA<T>::assign(const std::vector<TofMeasurement>& measurement_vec) {
+  std::size_t count = 0;
+  for (const auto& measurement : measurement_vec) {
+    count += measurement.point_cloud.data.size();
+  }
+
+  clear();
+  reserve(count);
+
+  for (const auto& measurement : measurement_vec) {
+    append(measurement.point_cloud);
+  }
+}
+
+template <typename T> void GenericPointCloudSoA<T>::append(const PointCloud& point_cloud) {
+  const std::size_t offset = _size;
+  resize(_size + point_cloud.data.size());
+
+  T* px = x() + offset;
+  T* py = y() + offset;
+  T* pz = z() + offset;
+  T* pd = distance() + offset;
+  T* ps = sigma() + offset;
+  T* pi = userIdx() + offset;
+
+  for (const auto& point : point_cloud.data) {
+    *px++ = static_cast<T>(point.point.x());
+    *py++ = static_cast<T>(point.point.y());
+    *pz++ = static_cast<T>(point.point.z());
+    *pd++ = static_cast<T>(point.raw_distance);
+    *ps++ = static_cast<T>(point.sigma);
+    *pi++ = static_cast<T>(point.user_idx);
+  }
+}
+
+template <typename T> void GenericPointCloudSoA<T>::copyTo(T* buffer, int size) const {
+  if (size <= 0) {
+    return;
+  }
+
+  const std::size_t max_points = static_cast<std::size_t>(size) / COLUMNS;
+  const std::size_t count      = std::min(_size, max_points);
+
+  for (std::size_t c = 0; c < COLUMNS; ++c) {
+    std::copy_n(column(c), count, buffer + c * max_points);
+  }
+}
+
+// Explicit template instantiation for the used types
+template class GenericPointCloudSoA<double>;
+template class GenericPointCloudSoA<float>;
+
+} // namespace measurement
+
+} // namespace eduart
@@ -0,0 +1,30 @@
+#include "sensorring/types/RingPointCloud.hpp"
+
+namespace eduart {
+
+namespace measurement {
+
+void RingPointCloud::assign(const std::vector<TofMeasurement>& measurement_vec, std::uint64_t timestamp) {
+  point_cloud.assign(measurement_vec);
+  timestamp_ns = timestamp;
+
+  ranges.clear();
+  std::size_t offset = 0;
+  for (const auto& measurement : measurement_vec) {
+    const auto& data = measurement.point_cloud.data;
+
+    PointCloudRange range;
+    range.user_idx             = data.empty() ? 0 : data.front().user_idx;
+    range.frame_id             = measurement.frame_id;
+    range.last_rx_timestamp_ns = measurement.last_rx_timestamp_ns;
+    range.offset               = offset;
+    range.count                = data.size();
+    ranges.push_back(range);
+
+    offset += data.size();
+  }
+}
+
+} // namespace measurement
+
+} // namespace eduart
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace eduart {
+
+/**
+ * @class Span
+ * @brief Non-owning view over a contiguous sequence of objects. Minimal replacement for std::span, which is not
+ * available in C++17. The viewed memory must outlive the span.
+ */
+template <typename T> class Span {
+public:
+  using element_type = T;
+  using iterator     = T*;
+
+  constexpr Span() noexcept
+      : _data(nullptr)
+      , _size(0) {}
+
+  constexpr Span(T* data, std::size_t size) noexcept
+      : _data(data)
+      , _size(size) {}
+
+  template <typename U, typename Alloc>
+  Span(const std::vector<U, Alloc>& vec) noexcept
+      : _data(vec.data())
+      , _size(vec.size()) {}
+
+  template <typename U, typename Alloc>
+  Span(std::vector<U, Alloc>& vec) noexcept
+      : _data(vec.data())
+      , _size(vec.size()) {}
+
+  constexpr T* data() const noexcept { return _data; }
+
+  constexpr std::size_t size() const noexcept { return _size; }
+
+  constexpr bool empty() const noexcept { return _size == 0; }
+
+  constexpr iterator begin() const noexcept { return _data; }
+
+  constexpr iterator end() const noexcept { return _data + _size; }
+
+  constexpr T& operator[](std::size_t idx) const noexcept { return _data[idx]; }
+
+  T& at(std::size_t idx) const {
+    if (idx >= _size) {
+      throw std::out_of_range("Span index out of range");
+    }
+    return _data[idx];
+  }
+
+private:
+  T* _data;
+  std::size_t _size;
+};
+
+/// Read-only view over a received message payload
+using ByteSpan = Span<const std::uint8_t>;
+
+} // namespace eduart
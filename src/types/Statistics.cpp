@@ -0,0 +1,49 @@
+#include "sensorring/types/Statistics.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace eduart {
+
+namespace manager {
+
+static constexpr double NS_PER_US = 1000.0;
+
+std::uint64_t LatencyHistogram::bucketUpperBoundNs(std::size_t idx) {
+  if (idx + 1 >= BUCKETS) {
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+  return std::uint64_t(1) << idx;
+}
+
+double LatencyHistogram::meanUs() const {
+  if (count == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(sum_ns) / static_cast<double>(count) / NS_PER_US;
+}
+
+double LatencyHistogram::maxUs() const {
+  return static_cast<double>(max_ns) / NS_PER_US;
+}
+
+double LatencyHistogram::percentileUs(double percentile) const {
+  if (count == 0) {
+    return 0.0;
+  }
+
+  // Rank of the requested sample, counted from 1
+  const double rank     = std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(count);
+  std::uint64_t covered = 0;
+  for (std::size_t i = 0; i < BUCKETS; ++i) {
+    covered += buckets[i];
+    if (covered > 0 && static_cast<double>(covered) >= rank) {
+      return static_cast<double>(std::min(bucketUpperBoundNs(i), max_ns)) / NS_PER_US;
+    }
+  }
+  return maxUs();
+}
+
+} // namespace manager
+
+} // namespace eduart
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace eduart {
+
+namespace utils {
+
+/**
+ * @class BoundedRing
+ * @brief Bounded lock-free queue for many producer threads. Every slot of the ring carries a sequence number that tells
+ * producers and consumers whether the slot is free or filled, so a push or pop is a single compare-and-swap on the
+ * write or read position and never waits for a lock. A full ring rejects new values instead of growing. Pops are safe
+ * from several threads as well, which allows producers to discard the oldest value when the ring is full.
+ */
+template <typename T> class BoundedRing {
+public:
+  /**
+   * Constructor
+   * @param[in] capacity minimum number of values the ring can hold, rounded up to the next power of two
+   */
+  explicit BoundedRing(std::size_t capacity)
+      : _capacity(roundUpToPowerOfTwo(capacity))
+      , _mask(_capacity - 1)
+      , _slots(std::make_unique<Slot[]>(_capacity))
+      , _write_pos(0)
+      , _read_pos(0) {
+    for (std::size_t i = 0; i < _capacity; i++) {
+      _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedRing(const BoundedRing&)            = delete;
+  BoundedRing& operator=(const BoundedRing&) = delete;
+
+  /**
+   * Append a value. Thread safe.
+   * @param[in] value value that is moved into the ring on success
+   * @return false if the ring is full
+   */
+  bool push(T&& value) {
+    auto pos = _write_pos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+      slot           = &_slots[pos & _mask];
+      const auto seq = slot->sequence.load(std::memory_order_acquire);
+      const auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if (dif == 0) {
+        if (_write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = _write_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->value = std::move(value);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Remove the oldest value. Thread safe.
+   * @param[out] value oldest value of the ring
+   * @return false if the ring is empty
+   */
+  bool pop(T& value) {
+    auto pos = _read_pos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+      slot           = &_slots[pos & _mask];
+      const auto seq = slot->sequence.load(std::memory_order_acquire);
+      const auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+      if (dif == 0) {
+        if (_read_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = _read_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    value = std::move(slot->value);
+    slot->sequence.store(pos + _capacity, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Check if the ring holds no values. The result may be outdated as soon as it is returned.
+   * @return true if the ring is empty
+   */
+  bool empty() const { return _read_pos.load(std::memory_order_acquire) >= _write_pos.load(std::memory_order_acquire); }
+
+  /**
+   * Get the number of values the ring can hold
+   * @return capacity of the ring
+   */
+  std::size_t capacity() const { return _capacity; }
+
+private:
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  static std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 2;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  const std::size_t _capacity;
+  const std::size_t _mask;
+  std::unique_ptr<Slot[]> _slots;
+
+  // The positions are written by different threads and are kept on separate cache lines
+  alignas(64) std::atomic<std::size_t> _write_pos;
+  alignas(64) std::atomic<std::size_t> _read_pos;
+};
+
+} // namespace utils
+
+} // namespace eduart
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace eduart {
+
+namespace utils {
+
+/**
+ * Current time of the system clock. All time stamps of the measurements use this clock, which is also the clock of the
+ * kernel receive time stamps of SocketCAN.
+ * @return nanoseconds since the epoch
+ */
+inline std::uint64_t systemTimeNs() {
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace utils
+
+} // namespace eduart
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace eduart {
+
+namespace utils {
+
+/**
+ * @class CompletionSignal
+ * @brief Wakes up threads that wait for a condition which is changed by another thread. The sensors signal every
+ * state change from the listener thread and the state machine worker blocks until its condition is fulfilled.
+ */
+class CompletionSignal {
+public:
+  /**
+   * Wake up all threads that are currently waiting on the signal
+   */
+  void notify() {
+    // Acquire the mutex once so that a waiting thread can't miss the notification between checking its predicate
+    // and going to sleep
+    { std::lock_guard<std::mutex> lock(_mutex); }
+    _cv.notify_all();
+  }
+
+  /**
+   * Block until the predicate is fulfilled or the timeout expires. The predicate is checked once before blocking and
+   * again after every notification.
+   * @param[in] timeout maximum time to wait
+   * @param[in] predicate condition to wait for
+   * @return result of the predicate when the wait returned
+   */
+  template <typename Predicate> bool waitFor(std::chrono::milliseconds timeout, Predicate predicate) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _cv.wait_for(lock, timeout, predicate);
+  }
+
+private:
+  std::mutex _mutex;
+  std::condition_variable _cv;
+};
+
+} // namespace utils
+
+} // namespace eduart
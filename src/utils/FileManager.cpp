@@ -20,6 +20,7 @@ namespace filemanager {
 // concrete types that are used in the program
 //==================================================
 
+template class filemanager::ArrayHandler<float, THERMAL_RESOLUTION>;
 template class filemanager::ArrayHandler<double, THERMAL_RESOLUTION>;
 template class filemanager::StructHandler<sensor::htpa32::HTPA32Eeprom>;
 
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "sensorring/types/Statistics.hpp"
+
+namespace eduart {
+
+namespace utils {
+
+/**
+ * @class LatencyRecorder
+ * @brief Lock-free counterpart of the LatencyHistogram. Any number of threads can record durations concurrently with
+ * one relaxed atomic increment per value, a snapshot may be taken at any time. The snapshot is not synchronized with the
+ * writers, so its fields may be off by the values that were recorded while it was taken.
+ */
+class LatencyRecorder {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Record a duration
+   * @param[in] duration duration to be recorded
+   */
+  void record(Clock::duration duration) {
+    const auto ns      = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    const auto value   = static_cast<std::uint64_t>(ns > 0 ? ns : 0);
+    std::size_t bucket = 0;
+    while (bucket + 1 < BUCKETS && (value >> bucket) != 0) {
+      bucket++;
+    }
+
+    _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum_ns.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t max = _max_ns.load(std::memory_order_relaxed);
+    while (value > max && !_max_ns.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * Record the time that passed since a point in time
+   * @param[in] start beginning of the duration
+   */
+  void recordSince(Clock::time_point start) { record(Clock::now() - start); }
+
+  /**
+   * Copy the recorded values
+   * @return histogram of the recorded durations
+   */
+  manager::LatencyHistogram snapshot() const {
+    manager::LatencyHistogram histogram;
+    for (std::size_t i = 0; i < BUCKETS; ++i) {
+      histogram.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+    }
+    histogram.count  = _count.load(std::memory_order_relaxed);
+    histogram.sum_ns = _sum_ns.load(std::memory_order_relaxed);
+    histogram.max_ns = _max_ns.load(std::memory_order_relaxed);
+    return histogram;
+  }
+
+private:
+  static constexpr std::size_t BUCKETS = manager::LatencyHistogram::BUCKETS;
+
+  std::array<std::atomic<std::uint64_t>, BUCKETS> _buckets = {};
+  std::atomic<std::uint64_t> _count{ 0 };
+  std::atomic<std::uint64_t> _sum_ns{ 0 };
+  std::atomic<std::uint64_t> _max_ns{ 0 };
+};
+
+/**
+ * @class ScopedLatency
+ * @brief Records the lifetime of the object with a LatencyRecorder
+ */
+class ScopedLatency {
+public:
+  explicit ScopedLatency(LatencyRecorder& recorder)
+      : _recorder(recorder)
+      , _start(LatencyRecorder::Clock::now()) {}
+
+  ~ScopedLatency() { _recorder.recordSince(_start); }
+
+  ScopedLatency(const ScopedLatency&)            = delete;
+  ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+  LatencyRecorder& _recorder;
+  LatencyRecorder::Clock::time_point _start;
+};
+
+} // namespace utils
+
+} // namespace eduart
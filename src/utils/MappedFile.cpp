@@ -0,0 +1,99 @@
+#include "utils/MappedFile.hpp"
+
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_FILE_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace eduart {
+
+namespace filemanager {
+
+MappedFile::MappedFile()
+    : _data(nullptr)
+    , _size(0)
+    , _map(nullptr) {
+}
+
+MappedFile::~MappedFile() {
+  close();
+}
+
+bool MappedFile::open(const std::string& filename) {
+  close();
+
+#ifdef MAPPED_FILE_USE_MMAP
+  const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  const auto size = static_cast<std::size_t>(file_stat.st_size);
+  if (size == 0) {
+    ::close(fd);
+    return false;
+  }
+
+  void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // the mapping stays valid without the file descriptor
+  if (map == MAP_FAILED) {
+    return false;
+  }
+
+  _map  = map;
+  _data = static_cast<const std::uint8_t*>(map);
+  _size = size;
+#else
+  std::ifstream file(filename, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  _buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  if (_buffer.empty()) {
+    return false;
+  }
+
+  _data = _buffer.data();
+  _size = _buffer.size();
+#endif
+
+  return true;
+}
+
+void MappedFile::close() {
+#ifdef MAPPED_FILE_USE_MMAP
+  if (_map) {
+    munmap(_map, _size);
+  }
+#endif
+  _buffer.clear();
+  _buffer.shrink_to_fit();
+  _map  = nullptr;
+  _data = nullptr;
+  _size = 0;
+}
+
+const std::uint8_t* MappedFile::data() const {
+  return _data;
+}
+
+std::size_t MappedFile::size() const {
+  return _size;
+}
+
+} // namespace filemanager
+
+} // namespace eduart
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eduart {
+
+namespace filemanager {
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole file. On POSIX systems the file is memory-mapped, so only the pages that are
+ * accessed are loaded and the kernel can drop them again under memory pressure. Other systems fall back to reading the
+ * whole file into memory.
+ */
+class MappedFile {
+public:
+  /**
+   * Constructor
+   */
+  MappedFile();
+
+  /**
+   * Destructor, unmaps the file
+   */
+  ~MappedFile();
+
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Map a file
+   * @param[in] filename path of the file
+   * @return success==true
+   */
+  bool open(const std::string& filename);
+
+  /**
+   * Unmap the file
+   */
+  void close();
+
+  /**
+   * Get the content of the file
+   * @return pointer to the first byte, nullptr if no file is mapped
+   */
+  const std::uint8_t* data() const;
+
+  /**
+   * Get the size of the file
+   * @return size in bytes
+   */
+  std::size_t size() const;
+
+private:
+  const std::uint8_t* _data;
+
+  std::size_t _size;
+
+  void* _map;
+
+  std::vector<std::uint8_t> _buffer;
+};
+
+} // namespace filemanager
+
+} // namespace eduart
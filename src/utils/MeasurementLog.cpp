@@ -0,0 +1,904 @@
+#include "sensorring/MeasurementLog.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+#include "sensorring/logger/Logger.hpp"
+#include "utils/BoundedRing.hpp"
+#include "utils/Clock.hpp"
+#include "utils/FileManager.hpp"
+#include "utils/MappedFile.hpp"
+#include "utils/MeasurementLogFormat.hpp"
+
+namespace eduart {
+
+namespace filemanager {
+
+using namespace measurementlog;
+
+namespace {
+
+template <typename T> void append(std::vector<std::uint8_t>& buffer, const T& value) {
+  const auto offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+void append(std::vector<std::uint8_t>& buffer, const void* data, std::size_t len) {
+  const auto offset = buffer.size();
+  buffer.resize(offset + len);
+  std::memcpy(buffer.data() + offset, data, len);
+}
+
+// Reads consecutive records of a frame and checks the bounds of the frame
+class FrameCursor {
+public:
+  FrameCursor(const std::uint8_t* data, std::size_t size)
+      : _data(data)
+      , _size(size)
+      , _offset(0) {}
+
+  template <typename T> bool read(T& value) { return read(&value, sizeof(T)); }
+
+  bool read(void* data, std::size_t len) {
+    if (_offset + len > _size) {
+      return false;
+    }
+    std::memcpy(data, _data + _offset, len);
+    _offset += len;
+    return true;
+  }
+
+  // Checks that count records of the given size fit into the rest of the frame before they are allocated
+  bool fits(std::uint64_t count, std::size_t record_size) const { return count <= (_size - _offset) / record_size; }
+
+  const std::uint8_t* skip(std::size_t len) {
+    if (_offset + len > _size) {
+      return nullptr;
+    }
+    const auto data = _data + _offset;
+    _offset += len;
+    return data;
+  }
+
+private:
+  const std::uint8_t* _data;
+  std::size_t _size;
+  std::size_t _offset;
+};
+
+template <typename T> void readTemperatures(const std::uint8_t* data, measurement::TemperatureImage& image) {
+  for (std::size_t i = 0; i < THERMAL_RESOLUTION; i++) {
+    T value;
+    std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+    image.data[i] = static_cast<measurement::TemperatureScalar>(value);
+  }
+}
+
+std::string makeFilename(const std::string& filepath, const std::string& filename) {
+  return (PathHandler::resolvePath(filepath) / filename).string();
+}
+
+/**
+ * @struct PendingFrame
+ * @brief Serialized frame waiting in the queue of the writer thread
+ */
+struct PendingFrame {
+  LogFrameType type                = LogFrameType::Invalid;
+  std::uint32_t measurement_count = 0;
+  std::uint64_t timestamp_ns      = 0;
+  std::vector<std::uint8_t> data;
+};
+
+bool lessId(const IdEntry& a, const IdEntry& b) {
+  return std::tie(a.type, a.frame_id, a.frame_idx) < std::tie(b.type, b.frame_id, b.frame_idx);
+}
+
+// Appends the measurement frame ids of a serialized frame to the id index, the points and images are skipped
+bool collectFrameIds(std::uint32_t type, const std::uint8_t* data, std::size_t size, std::uint32_t measurement_count, std::size_t temperature_size, std::uint64_t frame_idx, std::vector<IdEntry>& ids) {
+  FrameCursor cursor(data, size);
+  for (std::uint32_t i = 0; i < measurement_count; i++) {
+    std::uint32_t frame_id = 0;
+    if (type == static_cast<std::uint32_t>(LogFrameType::Tof)) {
+      TofRecord record;
+      if (!cursor.read(record) || !cursor.skip(record.point_count * sizeof(PointRecord))) {
+        return false;
+      }
+      frame_id = record.frame_id;
+    } else if (type == static_cast<std::uint32_t>(LogFrameType::Thermal)) {
+      ThermalRecord record;
+      if (!cursor.read(record) || !cursor.skip(THERMAL_RESOLUTION * temperature_size + sizeof(measurement::GrayscaleImage::data) + sizeof(measurement::FalseColorImage::data))) {
+        return false;
+      }
+      frame_id = record.frame_id;
+    } else {
+      return false;
+    }
+    ids.push_back(IdEntry{ type, frame_id, frame_idx });
+  }
+  return true;
+}
+
+} // namespace
+
+//==================================================
+// MeasurementLogWriterImpl
+//==================================================
+
+/**
+ * @class MeasurementLogWriterImpl
+ * @brief Implementation class of the MeasurementLogWriter to hide private members. The measurements are serialized by
+ * the calling thread and handed to the writer thread through a lock-free queue, so the acquisition callbacks never wait
+ * for the file. The buffers of written frames are returned to a second queue and reused by the next calls.
+ */
+class MeasurementLogWriterImpl {
+public:
+  MeasurementLogWriterImpl();
+
+  bool open(const std::string& filename);
+
+  void close();
+
+  bool isOpen() const;
+
+  PendingFrame acquireFrame();
+
+  bool submit(PendingFrame&& frame);
+
+  std::size_t getFrameCount() const;
+
+  std::mutex _mutex;
+
+private:
+  void writerWorker();
+
+  void writeFrame(const PendingFrame& frame);
+
+  bool flushChunk();
+
+  // Frames are collected until the chunk exceeds this size or time span, which bounds the loss if the process ends
+  static constexpr std::size_t CHUNK_SIZE = 4 * 1024 * 1024;
+
+  static constexpr std::uint64_t CHUNK_DURATION_NS = 1000000000;
+
+  // Number of frames that may wait for the writer thread, about two seconds of measurements at the highest rates
+  static constexpr std::size_t QUEUE_CAPACITY = 64;
+
+  // Only bounds the reaction time of the writer thread to a missed notification
+  static constexpr std::chrono::milliseconds WRITER_WAIT_TIMEOUT = std::chrono::milliseconds(10);
+
+  utils::BoundedRing<PendingFrame> _queue;
+
+  utils::BoundedRing<PendingFrame> _free_frames;
+
+  std::thread _writer_thread;
+
+  std::mutex _writer_mutex;
+
+  std::condition_variable _writer_cv;
+
+  std::atomic<bool> _shut_down;
+
+  std::atomic<bool> _open;
+
+  std::atomic<std::size_t> _frame_count;
+
+  std::atomic<std::uint64_t> _dropped_frames;
+
+  // The members below are only accessed by the writer thread while the log is open
+  std::uint64_t _reported_dropped_frames = 0;
+
+  bool _write_failed = false;
+
+  std::ofstream _file;
+
+  std::uint64_t _file_offset = 0;
+
+  std::vector<std::uint8_t> _chunk;
+
+  std::uint32_t _chunk_frame_count = 0;
+
+  std::uint64_t _chunk_first_timestamp_ns = 0;
+
+  std::uint64_t _chunk_last_timestamp_ns = 0;
+
+  std::vector<IndexEntry> _index;
+
+  std::vector<IdEntry> _ids;
+};
+
+MeasurementLogWriterImpl::MeasurementLogWriterImpl()
+    : _queue(QUEUE_CAPACITY)
+    , _free_frames(QUEUE_CAPACITY)
+    , _shut_down(false)
+    , _open(false)
+    , _frame_count(0)
+    , _dropped_frames(0) {
+}
+
+bool MeasurementLogWriterImpl::open(const std::string& filename) {
+  close();
+
+  _file.open(filename, std::ios::binary | std::ios::trunc);
+  if (!_file) {
+    return false;
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+  header.version          = VERSION;
+  header.temperature_size = sizeof(measurement::TemperatureScalar);
+
+  _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  _file.flush();
+  if (!_file) {
+    _file.close();
+    return false;
+  }
+
+  _file_offset             = sizeof(header);
+  _chunk_frame_count       = 0;
+  _reported_dropped_frames = 0;
+  _write_failed            = false;
+  _chunk.clear();
+  _chunk.reserve(CHUNK_SIZE + CHUNK_SIZE / 4);
+  _index.clear();
+  _ids.clear();
+  _frame_count    = 0;
+  _dropped_frames = 0;
+  _shut_down      = false;
+
+  try {
+    _writer_thread = std::thread(&MeasurementLogWriterImpl::writerWorker, this);
+  } catch (const std::exception&) {
+    _file.close();
+    throw;
+  }
+  _open = true;
+
+  return true;
+}
+
+void MeasurementLogWriterImpl::close() {
+  if (!_file.is_open()) {
+    return;
+  }
+
+  // no frames are submitted after this point, so the writer thread drains the complete queue before it stops
+  _open = false;
+  {
+    std::lock_guard<std::mutex> guard(_writer_mutex);
+    _shut_down = true;
+  }
+  _writer_cv.notify_one();
+  if (_writer_thread.joinable()) {
+    _writer_thread.join();
+  }
+
+  flushChunk();
+
+  std::vector<TimeEntry> time_index(_index.size());
+  for (std::size_t idx = 0; idx < _index.size(); idx++) {
+    time_index[idx] = TimeEntry{ _index[idx].timestamp_ns, idx };
+  }
+  std::stable_sort(time_index.begin(), time_index.end(), [](const TimeEntry& a, const TimeEntry& b) { return a.timestamp_ns < b.timestamp_ns; });
+  std::sort(_ids.begin(), _ids.end(), lessId);
+
+  IndexHeader index_header{};
+  std::memcpy(index_header.magic, INDEX_MAGIC, sizeof(index_header.magic));
+  index_header.frame_count = _index.size();
+  index_header.id_count    = _ids.size();
+
+  const auto index_offset = _file_offset;
+  _file.write(reinterpret_cast<const char*>(&index_header), sizeof(index_header));
+  _file.write(reinterpret_cast<const char*>(_index.data()), static_cast<std::streamsize>(_index.size() * sizeof(IndexEntry)));
+  _file.write(reinterpret_cast<const char*>(time_index.data()), static_cast<std::streamsize>(time_index.size() * sizeof(TimeEntry)));
+  _file.write(reinterpret_cast<const char*>(_ids.data()), static_cast<std::streamsize>(_ids.size() * sizeof(IdEntry)));
+
+  // the index is only referenced once it is written completely
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+  header.version          = VERSION;
+  header.temperature_size = sizeof(measurement::TemperatureScalar);
+  header.index_offset     = index_offset;
+  header.frame_count      = _index.size();
+
+  _file.flush();
+  _file.seekp(0);
+  _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  _file.close();
+
+  _index.clear();
+  _index.shrink_to_fit();
+  _ids.clear();
+  _ids.shrink_to_fit();
+  _chunk.clear();
+  _chunk.shrink_to_fit();
+}
+
+bool MeasurementLogWriterImpl::isOpen() const {
+  return _open.load(std::memory_order_acquire);
+}
+
+PendingFrame MeasurementLogWriterImpl::acquireFrame() {
+  PendingFrame frame;
+  if (_free_frames.pop(frame)) {
+    frame.data.clear();
+  }
+  return frame;
+}
+
+bool MeasurementLogWriterImpl::submit(PendingFrame&& frame) {
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (!isOpen()) {
+      return false;
+    }
+    if (!_queue.push(std::move(frame))) {
+      _dropped_frames.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _frame_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  _writer_cv.notify_one();
+  return true;
+}
+
+std::size_t MeasurementLogWriterImpl::getFrameCount() const {
+  return _frame_count.load(std::memory_order_relaxed);
+}
+
+void MeasurementLogWriterImpl::writerWorker() {
+  PendingFrame frame;
+  while (true) {
+    // the flag is read before the queue is drained, so no frame that was submitted before the shut down is lost
+    const bool shut_down = _shut_down.load(std::memory_order_acquire);
+
+    while (_queue.pop(frame)) {
+      try {
+        writeFrame(frame);
+      } catch (const std::exception& e) {
+        logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, std::string("Unable to write a frame to the measurement log: ") + e.what());
+      }
+      _free_frames.push(std::move(frame));
+      frame = PendingFrame();
+    }
+
+    const auto dropped = _dropped_frames.load(std::memory_order_relaxed);
+    if (dropped != _reported_dropped_frames) {
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "The measurement log queue was full, dropped " + std::to_string(dropped - _reported_dropped_frames) + " frames");
+      _reported_dropped_frames = dropped;
+    }
+
+    if (shut_down) {
+      break;
+    }
+
+    std::unique_lock<std::mutex> lock(_writer_mutex);
+    _writer_cv.wait_for(lock, WRITER_WAIT_TIMEOUT, [this] { return !_queue.empty() || _shut_down.load(std::memory_order_acquire); });
+  }
+}
+
+void MeasurementLogWriterImpl::writeFrame(const PendingFrame& frame) {
+  FrameHeader header{};
+  header.timestamp_ns      = frame.timestamp_ns;
+  header.size              = frame.data.size();
+  header.type              = static_cast<std::uint32_t>(frame.type);
+  header.measurement_count = frame.measurement_count;
+
+  if (_chunk_frame_count == 0) {
+    _chunk_first_timestamp_ns = frame.timestamp_ns;
+  }
+  _chunk_last_timestamp_ns = frame.timestamp_ns;
+
+  collectFrameIds(header.type, frame.data.data(), frame.data.size(), frame.measurement_count, sizeof(measurement::TemperatureScalar), _index.size(), _ids);
+  _index.push_back(IndexEntry{ frame.timestamp_ns, _file_offset + sizeof(ChunkHeader) + _chunk.size(), header.type, frame.measurement_count });
+  append(_chunk, header);
+  append(_chunk, frame.data.data(), frame.data.size());
+  _chunk_frame_count++;
+
+  if (_chunk.size() >= CHUNK_SIZE || _chunk_last_timestamp_ns - std::min(_chunk_first_timestamp_ns, _chunk_last_timestamp_ns) >= CHUNK_DURATION_NS) {
+    if (!flushChunk() && !_write_failed) {
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Unable to write to the measurement log, the log is incomplete");
+      _write_failed = true;
+    }
+  }
+}
+
+bool MeasurementLogWriterImpl::flushChunk() {
+  if (_chunk_frame_count == 0) {
+    return true;
+  }
+
+  ChunkHeader header{};
+  std::memcpy(header.magic, CHUNK_MAGIC, sizeof(header.magic));
+  header.frame_count        = _chunk_frame_count;
+  header.size               = _chunk.size();
+  header.first_timestamp_ns = _chunk_first_timestamp_ns;
+  header.last_timestamp_ns  = _chunk_last_timestamp_ns;
+
+  _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  _file.write(reinterpret_cast<const char*>(_chunk.data()), static_cast<std::streamsize>(_chunk.size()));
+  _file.flush();
+
+  _file_offset += sizeof(header) + _chunk.size();
+  _chunk.clear();
+  _chunk_frame_count = 0;
+
+  return static_cast<bool>(_file);
+}
+
+//==================================================
+// MeasurementLogWriter
+//==================================================
+
+MeasurementLogWriter::MeasurementLogWriter()
+    : _writer_impl(std::make_unique<MeasurementLogWriterImpl>()) {
+}
+
+MeasurementLogWriter::~MeasurementLogWriter() noexcept {
+  close();
+}
+
+bool MeasurementLogWriter::open(const std::string filepath, const std::string filename) noexcept {
+  try {
+    if (!PathHandler::checkDirectory(PathHandler::resolvePath(filepath))) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> guard(_writer_impl->_mutex);
+    if (!_writer_impl->open(makeFilename(filepath, filename))) {
+      logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, "Unable to create the measurement log " + makeFilename(filepath, filename));
+      return false;
+    }
+  } catch (const std::exception& e) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, std::string("Unable to create the measurement log: ") + e.what());
+    return false;
+  }
+  return true;
+}
+
+bool MeasurementLogWriter::open(const std::string filename) noexcept {
+  return open("", filename);
+}
+
+void MeasurementLogWriter::close() noexcept {
+  std::lock_guard<std::mutex> guard(_writer_impl->_mutex);
+  _writer_impl->close();
+}
+
+bool MeasurementLogWriter::isOpen() const noexcept {
+  return _writer_impl->isOpen();
+}
+
+bool MeasurementLogWriter::writeTofMeasurement(const std::vector<measurement::TofMeasurement>& measurement_vec) noexcept {
+  if (!_writer_impl->isOpen()) {
+    return false;
+  }
+
+  try {
+    auto frame = _writer_impl->acquireFrame();
+
+    std::uint64_t timestamp_ns = 0;
+    for (const auto& measurement : measurement_vec) {
+      TofRecord record{};
+      record.frame_id              = measurement.frame_id;
+      record.point_count           = static_cast<std::uint32_t>(measurement.point_cloud.data.size());
+      record.first_rx_timestamp_ns = measurement.first_rx_timestamp_ns;
+      record.last_rx_timestamp_ns  = measurement.last_rx_timestamp_ns;
+      append(frame.data, record);
+
+      for (const auto& point : measurement.point_cloud.data) {
+        PointRecord point_record{};
+        point_record.x            = point.point.x();
+        point_record.y            = point.point.y();
+        point_record.z            = point.point.z();
+        point_record.raw_distance = point.raw_distance;
+        point_record.sigma        = point.sigma;
+        point_record.user_idx     = point.user_idx;
+        append(frame.data, point_record);
+      }
+
+      timestamp_ns = std::max(timestamp_ns, measurement.last_rx_timestamp_ns);
+    }
+
+    frame.type              = LogFrameType::Tof;
+    frame.measurement_count = static_cast<std::uint32_t>(measurement_vec.size());
+    frame.timestamp_ns      = (timestamp_ns > 0) ? timestamp_ns : utils::systemTimeNs();
+    return _writer_impl->submit(std::move(frame));
+  } catch (const std::exception&) {
+    return false;
+  }
+}
+
+bool MeasurementLogWriter::writeThermalMeasurement(const std::vector<measurement::ThermalMeasurement>& measurement_vec) noexcept {
+  if (!_writer_impl->isOpen()) {
+    return false;
+  }
+
+  try {
+    auto frame = _writer_impl->acquireFrame();
+
+    std::uint64_t timestamp_ns = 0;
+    for (const auto& measurement : measurement_vec) {
+      ThermalRecord record{};
+      record.frame_id              = measurement.frame_id;
+      record.user_idx              = measurement.user_idx;
+      record.first_rx_timestamp_ns = measurement.first_rx_timestamp_ns;
+      record.last_rx_timestamp_ns  = measurement.last_rx_timestamp_ns;
+      record.t_ambient_deg_c       = measurement.t_ambient_deg_c;
+      record.min_deg_c             = measurement.min_deg_c;
+      record.max_deg_c             = measurement.max_deg_c;
+      append(frame.data, record);
+      append(frame.data, measurement.temp_data_deg_c.data.data(), sizeof(measurement.temp_data_deg_c.data));
+      append(frame.data, measurement.grayscale_img.data.data(), sizeof(measurement.grayscale_img.data));
+      append(frame.data, measurement.falsecolor_img.data.data(), sizeof(measurement.falsecolor_img.data));
+
+      timestamp_ns = std::max(timestamp_ns, measurement.last_rx_timestamp_ns);
+    }
+
+    frame.type              = LogFrameType::Thermal;
+    frame.measurement_count = static_cast<std::uint32_t>(measurement_vec.size());
+    frame.timestamp_ns      = (timestamp_ns > 0) ? timestamp_ns : utils::systemTimeNs();
+    return _writer_impl->submit(std::move(frame));
+  } catch (const std::exception&) {
+    return false;
+  }
+}
+
+std::size_t MeasurementLogWriter::getFrameCount() const noexcept {
+  return _writer_impl->getFrameCount();
+}
+
+void MeasurementLogWriter::onTransformedTofMeasurement(const std::vector<measurement::TofMeasurement>& measurement_vec) {
+  writeTofMeasurement(measurement_vec);
+}
+
+void MeasurementLogWriter::onThermalMeasurement(const std::vector<measurement::ThermalMeasurement>& measurement_vec) {
+  writeThermalMeasurement(measurement_vec);
+}
+
+//==================================================
+// MeasurementLogReaderImpl
+//==================================================
+
+/**
+ * @class MeasurementLogReaderImpl
+ * @brief Implementation class of the MeasurementLogReader to hide private members.
+ */
+class MeasurementLogReaderImpl {
+public:
+  bool open(const std::string& filename);
+
+  void close();
+
+  const IndexEntry* getEntry(std::size_t frame_idx) const;
+
+  bool getFrame(std::size_t frame_idx, LogFrameType type, FrameHeader& header, const std::uint8_t*& data) const;
+
+  MappedFile _file;
+
+  std::uint32_t _temperature_size = 0;
+
+  std::vector<IndexEntry> _index;
+
+  std::vector<TimeEntry> _time_index;
+
+  std::vector<IdEntry> _ids;
+
+private:
+  bool loadIndex(std::uint64_t index_offset, std::uint64_t frame_count);
+
+  void rebuildIndex();
+};
+
+bool MeasurementLogReaderImpl::open(const std::string& filename) {
+  close();
+
+  if (!_file.open(filename)) {
+    return false;
+  }
+
+  FileHeader header;
+  if (_file.size() < sizeof(header)) {
+    close();
+    return false;
+  }
+  std::memcpy(&header, _file.data(), sizeof(header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || (header.temperature_size != sizeof(float) && header.temperature_size != sizeof(double))) {
+    close();
+    return false;
+  }
+  _temperature_size = header.temperature_size;
+
+  if (!loadIndex(header.index_offset, header.frame_count)) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Info, "The measurement log " + filename + " was not closed properly, rebuilding the index from the complete chunks");
+    rebuildIndex();
+  }
+
+  return true;
+}
+
+void MeasurementLogReaderImpl::close() {
+  _file.close();
+  _index.clear();
+  _time_index.clear();
+  _ids.clear();
+  _temperature_size = 0;
+}
+
+bool MeasurementLogReaderImpl::loadIndex(std::uint64_t index_offset, std::uint64_t frame_count) {
+  if (index_offset == 0 || index_offset > _file.size() || sizeof(IndexHeader) > _file.size() - index_offset) {
+    return false;
+  }
+
+  IndexHeader header;
+  std::memcpy(&header, _file.data() + index_offset, sizeof(header));
+  if (std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 || header.frame_count != frame_count) {
+    return false;
+  }
+
+  const std::uint64_t available = _file.size() - index_offset - sizeof(header);
+  if (frame_count > available / (sizeof(IndexEntry) + sizeof(TimeEntry)) || header.id_count > (available - frame_count * (sizeof(IndexEntry) + sizeof(TimeEntry))) / sizeof(IdEntry)) {
+    return false;
+  }
+
+  const auto entries = _file.data() + index_offset + sizeof(header);
+  _index.resize(frame_count);
+  _time_index.resize(frame_count);
+  _ids.resize(header.id_count);
+  std::memcpy(_index.data(), entries, frame_count * sizeof(IndexEntry));
+  std::memcpy(_time_index.data(), entries + frame_count * sizeof(IndexEntry), frame_count * sizeof(TimeEntry));
+  std::memcpy(_ids.data(), entries + frame_count * (sizeof(IndexEntry) + sizeof(TimeEntry)), header.id_count * sizeof(IdEntry));
+
+  return true;
+}
+
+void MeasurementLogReaderImpl::rebuildIndex() {
+  _index.clear();
+  _time_index.clear();
+  _ids.clear();
+
+  // only the headers and the measurement records are read, the points and images are skipped
+  std::uint64_t offset = sizeof(FileHeader);
+  while (offset + sizeof(ChunkHeader) <= _file.size()) {
+    ChunkHeader chunk;
+    std::memcpy(&chunk, _file.data() + offset, sizeof(chunk));
+    offset += sizeof(chunk);
+
+    if (std::memcmp(chunk.magic, CHUNK_MAGIC, sizeof(CHUNK_MAGIC)) != 0 || chunk.size > _file.size() - offset) {
+      break;
+    }
+
+    const auto chunk_end = offset + chunk.size;
+    for (std::uint32_t i = 0; i < chunk.frame_count && offset + sizeof(FrameHeader) <= chunk_end; i++) {
+      FrameHeader frame;
+      std::memcpy(&frame, _file.data() + offset, sizeof(frame));
+      if (frame.size > chunk_end - offset - sizeof(frame)) {
+        break;
+      }
+      collectFrameIds(frame.type, _file.data() + offset + sizeof(frame), static_cast<std::size_t>(frame.size), frame.measurement_count, _temperature_size, _index.size(), _ids);
+      _index.push_back(IndexEntry{ frame.timestamp_ns, offset, frame.type, frame.measurement_count });
+      offset += sizeof(frame) + frame.size;
+    }
+    offset = chunk_end;
+  }
+
+  _time_index.resize(_index.size());
+  for (std::size_t idx = 0; idx < _index.size(); idx++) {
+    _time_index[idx] = TimeEntry{ _index[idx].timestamp_ns, idx };
+  }
+  std::stable_sort(_time_index.begin(), _time_index.end(), [](const TimeEntry& a, const TimeEntry& b) { return a.timestamp_ns < b.timestamp_ns; });
+  std::sort(_ids.begin(), _ids.end(), lessId);
+}
+
+const IndexEntry* MeasurementLogReaderImpl::getEntry(std::size_t frame_idx) const {
+  return (frame_idx < _index.size()) ? &_index[frame_idx] : nullptr;
+}
+
+bool MeasurementLogReaderImpl::getFrame(std::size_t frame_idx, LogFrameType type, FrameHeader& header, const std::uint8_t*& data) const {
+  const auto entry = getEntry(frame_idx);
+  if (!entry || entry->type != static_cast<std::uint32_t>(type) || entry->offset > _file.size() || sizeof(header) > _file.size() - entry->offset) {
+    return false;
+  }
+
+  std::memcpy(&header, _file.data() + entry->offset, sizeof(header));
+  if (header.type != entry->type || header.size > _file.size() - entry->offset - sizeof(header)) {
+    return false;
+  }
+
+  data = _file.data() + entry->offset + sizeof(header);
+  return true;
+}
+
+//==================================================
+// MeasurementLogReader
+//==================================================
+
+MeasurementLogReader::MeasurementLogReader()
+    : _reader_impl(std::make_unique<MeasurementLogReaderImpl>()) {
+}
+
+MeasurementLogReader::~MeasurementLogReader() noexcept {
+  close();
+}
+
+bool MeasurementLogReader::open(const std::string filepath, const std::string filename) noexcept {
+  try {
+    return _reader_impl->open(makeFilename(filepath, filename));
+  } catch (const std::exception& e) {
+    logger::Logger::getInstance()->log(logger::LogVerbosity::Warning, std::string("Unable to open the measurement log: ") + e.what());
+    _reader_impl->close();
+    return false;
+  }
+}
+
+bool MeasurementLogReader::open(const std::string filename) noexcept {
+  return open("", filename);
+}
+
+void MeasurementLogReader::close() noexcept {
+  _reader_impl->close();
+}
+
+bool MeasurementLogReader::isOpen() const noexcept {
+  return _reader_impl->_file.data() != nullptr;
+}
+
+std::size_t MeasurementLogReader::getFrameCount() const noexcept {
+  return _reader_impl->_index.size();
+}
+
+LogFrameType MeasurementLogReader::getFrameType(std::size_t frame_idx) const noexcept {
+  const auto entry = _reader_impl->getEntry(frame_idx);
+  return entry ? static_cast<LogFrameType>(entry->type) : LogFrameType::Invalid;
+}
+
+std::uint64_t MeasurementLogReader::getFrameTimestamp(std::size_t frame_idx) const noexcept {
+  const auto entry = _reader_impl->getEntry(frame_idx);
+  return entry ? entry->timestamp_ns : 0;
+}
+
+std::vector<std::size_t> MeasurementLogReader::findFrames(std::uint64_t begin_ns, std::uint64_t end_ns) const noexcept {
+  const auto& time_index = _reader_impl->_time_index;
+  const auto first = std::lower_bound(time_index.begin(), time_index.end(), begin_ns, [](const TimeEntry& entry, std::uint64_t t) { return entry.timestamp_ns < t; });
+  const auto last  = std::lower_bound(first, time_index.end(), end_ns, [](const TimeEntry& entry, std::uint64_t t) { return entry.timestamp_ns < t; });
+
+  std::vector<std::size_t> frames;
+  try {
+    frames.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (auto it = first; it != last; it++) {
+      frames.push_back(static_cast<std::size_t>(it->frame_idx));
+    }
+  } catch (const std::exception&) {
+    frames.clear();
+  }
+  return frames;
+}
+
+std::vector<std::size_t> MeasurementLogReader::findFramesById(LogFrameType type, std::uint32_t frame_id) const noexcept {
+  const auto& ids  = _reader_impl->_ids;
+  const IdEntry lo = { static_cast<std::uint32_t>(type), frame_id, 0 };
+  const IdEntry hi = { static_cast<std::uint32_t>(type), frame_id, UINT64_MAX };
+  const auto first = std::lower_bound(ids.begin(), ids.end(), lo, lessId);
+  const auto last  = std::upper_bound(first, ids.end(), hi, lessId);
+
+  // the ids of one frame are adjacent, every frame is reported once
+  std::vector<std::size_t> frames;
+  try {
+    for (auto it = first; it != last; it++) {
+      if (frames.empty() || frames.back() != it->frame_idx) {
+        frames.push_back(static_cast<std::size_t>(it->frame_idx));
+      }
+    }
+  } catch (const std::exception&) {
+    frames.clear();
+  }
+  return frames;
+}
+
+bool MeasurementLogReader::readTofFrame(std::size_t frame_idx, std::vector<measurement::TofMeasurement>& measurement_vec) const noexcept {
+  FrameHeader header;
+  const std::uint8_t* data = nullptr;
+  if (!_reader_impl->getFrame(frame_idx, LogFrameType::Tof, header, data)) {
+    return false;
+  }
+
+  try {
+    FrameCursor cursor(data, static_cast<std::size_t>(header.size));
+    if (!cursor.fits(header.measurement_count, sizeof(TofRecord))) {
+      return false;
+    }
+    measurement_vec.resize(header.measurement_count);
+    for (auto& measurement : measurement_vec) {
+      TofRecord record;
+      if (!cursor.read(record)) {
+        return false;
+      }
+      measurement.frame_id              = record.frame_id;
+      measurement.first_rx_timestamp_ns = record.first_rx_timestamp_ns;
+      measurement.last_rx_timestamp_ns  = record.last_rx_timestamp_ns;
+
+      if (!cursor.fits(record.point_count, sizeof(PointRecord))) {
+        return false;
+      }
+      measurement.point_cloud.data.resize(record.point_count);
+      for (auto& point : measurement.point_cloud.data) {
+        PointRecord point_record;
+        if (!cursor.read(point_record)) {
+          return false;
+        }
+        point.point        = { point_record.x, point_record.y, point_record.z };
+        point.raw_distance = point_record.raw_distance;
+        point.sigma        = point_record.sigma;
+        point.user_idx     = point_record.user_idx;
+      }
+    }
+  } catch (const std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool MeasurementLogReader::readThermalFrame(std::size_t frame_idx, std::vector<measurement::ThermalMeasurement>& measurement_vec) const noexcept {
+  FrameHeader header;
+  const std::uint8_t* data = nullptr;
+  if (!_reader_impl->getFrame(frame_idx, LogFrameType::Thermal, header, data)) {
+    return false;
+  }
+
+  const auto temperature_size = _reader_impl->_temperature_size;
+  try {
+    FrameCursor cursor(data, static_cast<std::size_t>(header.size));
+    if (!cursor.fits(header.measurement_count, sizeof(ThermalRecord))) {
+      return false;
+    }
+    measurement_vec.resize(header.measurement_count);
+    for (auto& measurement : measurement_vec) {
+      ThermalRecord record;
+      if (!cursor.read(record)) {
+        return false;
+      }
+      measurement.frame_id              = record.frame_id;
+      measurement.user_idx              = record.user_idx;
+      measurement.first_rx_timestamp_ns = record.first_rx_timestamp_ns;
+      measurement.last_rx_timestamp_ns  = record.last_rx_timestamp_ns;
+      measurement.t_ambient_deg_c       = record.t_ambient_deg_c;
+      measurement.min_deg_c             = record.min_deg_c;
+      measurement.max_deg_c             = record.max_deg_c;
+
+      // logs of builds with a different thermal precision are converted
+      const auto temperatures = cursor.skip(THERMAL_RESOLUTION * temperature_size);
+      if (!temperatures) {
+        return false;
+      }
+      if (temperature_size == sizeof(float)) {
+        readTemperatures<float>(temperatures, measurement.temp_data_deg_c);
+      } else {
+        readTemperatures<double>(temperatures, measurement.temp_data_deg_c);
+      }
+
+      if (!cursor.read(measurement.grayscale_img.data.data(), sizeof(measurement.grayscale_img.data)) || !cursor.read(measurement.falsecolor_img.data.data(), sizeof(measurement.falsecolor_img.data))) {
+        return false;
+      }
+    }
+  } catch (const std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace filemanager
+
+} // namespace eduart
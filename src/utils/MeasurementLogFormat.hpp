@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eduart {
+
+namespace filemanager {
+
+/**
+ * Binary format of the measurement logs. A log starts with the file header, followed by chunks of frames. Each chunk
+ * consists of the chunk header and the frames of the chunk, each frame of the frame header and the serialized
+ * measurements. A Time-of-Flight measurement is stored as TofRecord followed by one PointRecord per point. A thermal
+ * measurement is stored as ThermalRecord followed by the temperature image in the precision given in the file header,
+ * the grayscale image and the false color image. The index at the end of the file consists of the index header, one
+ * IndexEntry per frame in the order of the log, one TimeEntry per frame sorted by time and one IdEntry per measurement
+ * sorted by type, frame id and frame. All records are multiples of eight bytes long and all values are little endian.
+ * The file header points to the index once the log is closed.
+ */
+namespace measurementlog {
+
+static constexpr char MAGIC[8]        = { 'S', 'R', 'M', 'E', 'A', 'S', 'L', 'G' };
+static constexpr char CHUNK_MAGIC[4]  = { 'C', 'H', 'N', 'K' };
+static constexpr char INDEX_MAGIC[4]  = { 'I', 'N', 'D', 'X' };
+static constexpr std::uint32_t VERSION = 2;
+
+struct FileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t temperature_size;
+  std::uint64_t index_offset;
+  std::uint64_t frame_count;
+};
+
+struct ChunkHeader {
+  char magic[4];
+  std::uint32_t frame_count;
+  std::uint64_t size;
+  std::uint64_t first_timestamp_ns;
+  std::uint64_t last_timestamp_ns;
+};
+
+struct FrameHeader {
+  std::uint64_t timestamp_ns;
+  std::uint64_t size;
+  std::uint32_t type;
+  std::uint32_t measurement_count;
+};
+
+struct TofRecord {
+  std::uint32_t frame_id;
+  std::uint32_t point_count;
+  std::uint64_t first_rx_timestamp_ns;
+  std::uint64_t last_rx_timestamp_ns;
+};
+
+struct PointRecord {
+  double x;
+  double y;
+  double z;
+  double raw_distance;
+  double sigma;
+  std::int32_t user_idx;
+  std::uint32_t reserved;
+};
+
+struct ThermalRecord {
+  std::uint32_t frame_id;
+  std::uint32_t user_idx;
+  std::uint64_t first_rx_timestamp_ns;
+  std::uint64_t last_rx_timestamp_ns;
+  double t_ambient_deg_c;
+  double min_deg_c;
+  double max_deg_c;
+};
+
+struct IndexHeader {
+  char magic[4];
+  std::uint32_t reserved;
+  std::uint64_t frame_count;
+  std::uint64_t id_count;
+};
+
+struct IndexEntry {
+  std::uint64_t timestamp_ns;
+  std::uint64_t offset;
+  std::uint32_t type;
+  std::uint32_t measurement_count;
+};
+
+struct TimeEntry {
+  std::uint64_t timestamp_ns;
+  std::uint64_t frame_idx;
+};
+
+struct IdEntry {
+  std::uint32_t type;
+  std::uint32_t frame_id;
+  std::uint64_t frame_idx;
+};
+
+static_assert(sizeof(FileHeader) == 32, "unexpected padding in the measurement log file header");
+static_assert(sizeof(ChunkHeader) == 32, "unexpected padding in the measurement log chunk header");
+static_assert(sizeof(FrameHeader) == 24, "unexpected padding in the measurement log frame header");
+static_assert(sizeof(TofRecord) == 24, "unexpected padding in the measurement log ToF record");
+static_assert(sizeof(PointRecord) == 48, "unexpected padding in the measurement log point record");
+static_assert(sizeof(ThermalRecord) == 48, "unexpected padding in the measurement log thermal record");
+static_assert(sizeof(IndexHeader) == 24, "unexpected padding in the measurement log index header");
+static_assert(sizeof(IndexEntry) == 24, "unexpected padding in the measurement log index entry");
+static_assert(sizeof(TimeEntry) == 16, "unexpected padding in the measurement log time entry");
+static_assert(sizeof(IdEntry) == 16, "unexpected padding in the measurement log id entry");
+
+} // namespace measurementlog
+
+} // namespace filemanager
+
+} // namespace eduart
@@ -0,0 +1,100 @@
+#pragma once
+
+/**
+ * Instrumentation for the Tracy profiler. The macros only expand to code if the library is configured with the CMake
+ * option SENSORRING_ENABLE_TRACY, otherwise they compile to nothing.
+ *
+ * PROFILE_ZONE(name)                 time the enclosing scope
+ * PROFILE_THREAD(name)               name the calling thread
+ * PROFILE_FRAME(name)                mark the end of a frame, e.g. a published ring measurement
+ * PROFILE_PLOT(name, value)          plot a value
+ * PROFILE_PLOT_RATE(name)            plot the rate at which the statement is reached in Hz
+ * PROFILE_PLOT_DURATION(name)        plot the time spent in the enclosing scope in ms
+ * PROFILE_COUNT_CAN_FRAMES(count)    count received CAN frames
+ * PROFILE_PLOT_CAN_FRAMES(name)      plot the CAN frames received since the last call
+ *
+ * Zone, frame and plot names must be string literals, thread names are copied.
+ */
+
+#ifdef SENSORRING_ENABLE_TRACY
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <tracy/Tracy.hpp>
+
+namespace eduart {
+
+namespace utils {
+
+namespace profiling {
+
+inline std::atomic<std::int64_t> can_frame_count{ 0 };
+
+class ScopedDurationPlot {
+public:
+  explicit ScopedDurationPlot(const char* name)
+      : _name(name)
+      , _start(std::chrono::steady_clock::now()) {}
+
+  ~ScopedDurationPlot() {
+    const double duration_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+    TracyPlot(_name, duration_ms);
+  }
+
+private:
+  const char* _name;
+  std::chrono::steady_clock::time_point _start;
+};
+
+class RatePlot {
+public:
+  explicit RatePlot(const char* name)
+      : _name(name)
+      , _last(std::chrono::steady_clock::now()) {}
+
+  void tick() {
+    const auto now = std::chrono::steady_clock::now();
+    TracyPlot(_name, 1.0 / std::chrono::duration<double>(now - _last).count());
+    _last = now;
+  }
+
+private:
+  const char* _name;
+  std::chrono::steady_clock::time_point _last;
+};
+
+} // namespace profiling
+
+} // namespace utils
+
+} // namespace eduart
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b)      PROFILE_CONCAT_IMPL(a, b)
+
+#define PROFILE_ZONE(name)        ZoneScopedN(name)
+#define PROFILE_THREAD(name)      tracy::SetThreadName(name)
+#define PROFILE_FRAME(name)       FrameMarkNamed(name)
+#define PROFILE_PLOT(name, value) TracyPlot(name, value)
+#define PROFILE_PLOT_RATE(name)                                                               \
+  do {                                                                                        \
+    static eduart::utils::profiling::RatePlot PROFILE_CONCAT(_profile_rate_, __LINE__)(name); \
+    PROFILE_CONCAT(_profile_rate_, __LINE__).tick();                                          \
+  } while (0)
+#define PROFILE_PLOT_DURATION(name)     eduart::utils::profiling::ScopedDurationPlot PROFILE_CONCAT(_profile_duration_, __LINE__)(name)
+#define PROFILE_COUNT_CAN_FRAMES(count) eduart::utils::profiling::can_frame_count.fetch_add(static_cast<std::int64_t>(count), std::memory_order_relaxed)
+#define PROFILE_PLOT_CAN_FRAMES(name)   TracyPlot(name, eduart::utils::profiling::can_frame_count.exchange(0, std::memory_order_relaxed))
+
+#else
+
+#define PROFILE_ZONE(name)
+#define PROFILE_THREAD(name)
+#define PROFILE_FRAME(name)
+#define PROFILE_PLOT(name, value)
+#define PROFILE_PLOT_RATE(name)
+#define PROFILE_PLOT_DURATION(name)
+#define PROFILE_COUNT_CAN_FRAMES(count)
+#define PROFILE_PLOT_CAN_FRAMES(name)
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace eduart {
+
+namespace utils {
+
+/**
+ * @class TripleBuffer
+ * @brief Lock-free handoff of the latest value from one writer thread to one reader thread. The writer fills a back
+ * buffer and publishes it by swapping it with the middle buffer. The reader swaps the middle buffer with its front
+ * buffer when a new value was published. Neither side ever blocks or sees a partially written value, and the buffers
+ * keep their allocations so the values can be written in place.
+ */
+template <typename T> class TripleBuffer {
+public:
+  TripleBuffer()
+      : _back(0)
+      , _middle(1)
+      , _front(2) {}
+
+  /**
+   * Get the buffer to be written by the writer thread. Holds the value that was published two updates ago.
+   * @return reference to the back buffer
+   */
+  T& writeBuffer() { return _buffers[_back]; }
+
+  /**
+   * Make the back buffer available to the reader thread. Must only be called by the writer thread.
+   */
+  void publish() { _back = _middle.exchange(_back | DIRTY_FLAG, std::memory_order_acq_rel) & INDEX_MASK; }
+
+  /**
+   * Fetch the most recently published buffer. Must only be called by the reader thread.
+   * @return true if a new value was published since the last update
+   */
+  bool update() {
+    if (!(_middle.load(std::memory_order_relaxed) & DIRTY_FLAG)) {
+      return false;
+    }
+    _front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+  /**
+   * Get the buffer to be read by the reader thread. Stays valid and unchanged until the next update.
+   * @return reference to the front buffer
+   */
+  const T& readBuffer() const { return _buffers[_front]; }
+
+private:
+  static constexpr std::uint8_t INDEX_MASK = 0x03;
+  static constexpr std::uint8_t DIRTY_FLAG = 0x04;
+
+  std::array<T, 3> _buffers;
+  std::uint8_t _back;
+  std::atomic<std::uint8_t> _middle;
+  std::uint8_t _front;
+};
+
+} // namespace utils
+
+} // namespace eduart